@@ -0,0 +1,130 @@
+/**
+ * @file BotInputSource.cpp
+ * @author Vld251
+ * @brief Implementation of the self-playing key source.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "BotInputSource.h"
+#include "../model/GameWorld.h"
+#include "../model/EnemyTank.h"
+
+#include <cstdlib>
+
+namespace {
+
+// Клавиши движения в порядке Direction: UP, DOWN, LEFT, RIGHT
+const char* const MOVE_KEYS[] = { "w", "s", "a", "d" };
+
+// Проверяет, что между двумя клетками одной линии нет стен
+bool hasLineOfFire(const TerrainGrid& terrain, Point from, Point to) {
+    int dx = (to.x > from.x) - (to.x < from.x);
+    int dy = (to.y > from.y) - (to.y < from.y);
+    Point p = from;
+
+    while (!(p == to)) {
+        p.x += dx;
+        p.y += dy;
+        if (!(p == to) && terrain.blocksProjectiles(p)) return false;
+    }
+    return true;
+}
+
+Direction directionTo(Point from, Point to) {
+    if (from.x == to.x) return (to.y > from.y) ? Direction::DOWN : Direction::UP;
+    return (to.x > from.x) ? Direction::RIGHT : Direction::LEFT;
+}
+
+const char* moveKey(Direction dir) {
+    return MOVE_KEYS[static_cast<int>(dir)];
+}
+
+}
+
+BotInputSource::BotInputSource(unsigned int seed, int interval)
+    : random(seed), intervalMs(interval), observation(0), sentObservation(0) {}
+
+std::string BotInputSource::chooseKey(const GameWorld& world) {
+    switch (world.getState()) {
+        case GameState::PLAYING:
+            break;
+        case GameState::PAUSED:
+            return "p";
+        case GameState::SETTINGS:
+            return "\033";
+        default:
+            // Меню, выбор карты, конец уровня и конец игры - начинаем следующую игру
+            return "\n";
+    }
+
+    const PlayerTank* player = world.getPlayer();
+    if (!player) return "\n";
+
+    // Иногда ходим случайно, чтобы не застревать у стен
+    if (random() % 5 == 0) {
+        return moveKey(static_cast<Direction>(random() % 4));
+    }
+
+    Point pos = player->getPosition();
+    const EnemyTank* target = nullptr;
+    int bestDistance = 0;
+
+    for (const auto& obj : world.getObjects()) {
+        const EnemyTank* enemy = dynamic_cast<const EnemyTank*>(obj.get());
+        if (!enemy || enemy->isDestroyed()) continue;
+
+        Point e = enemy->getPosition();
+        if ((e.x == pos.x || e.y == pos.y) && hasLineOfFire(world.getTerrain(), pos, e)) {
+            // Враг на линии огня: разворачиваемся к нему, затем стреляем
+            Direction dir = directionTo(pos, e);
+            return player->getDirection() == dir ? "f" : moveKey(dir);
+        }
+
+        int distance = std::abs(e.x - pos.x) + std::abs(e.y - pos.y);
+        if (!target || distance < bestDistance) {
+            target = enemy;
+            bestDistance = distance;
+        }
+    }
+
+    if (!target) return "f";
+
+    // Выравниваемся по оси с меньшим расхождением
+    Point e = target->getPosition();
+    int dx = e.x - pos.x;
+    int dy = e.y - pos.y;
+    if (dx != 0 && (dy == 0 || std::abs(dx) < std::abs(dy))) {
+        return moveKey(dx > 0 ? Direction::RIGHT : Direction::LEFT);
+    }
+    return moveKey(dy > 0 ? Direction::DOWN : Direction::UP);
+}
+
+void BotInputSource::observe(const GameWorld& world) {
+    std::string key = chooseKey(world);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        plannedKey = key;
+        observation++;
+    }
+    changed.notify_all();
+}
+
+bool BotInputSource::generate(Clock::time_point now, std::string& bytes, Clock::time_point& wakeAt) {
+    // Одна клавиша на каждое новое состояние: пока игра не прочитала прошлую, не спешим
+    if (observation == sentObservation) return false;
+
+    Clock::time_point due = lastSent + std::chrono::milliseconds(intervalMs);
+    if (now < due) {
+        wakeAt = due;
+        return false;
+    }
+
+    bytes = plannedKey;
+    sentObservation = observation;
+    lastSent = now;
+    return true;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file BotInputSource.h
+ * @author Vld251
+ * @brief Key source playing the game by itself.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef BOTINPUTSOURCE_H
+#define BOTINPUTSOURCE_H
+
+#include "InputSource.h"
+
+#include <random>
+#include <string>
+
+/**
+ * @brief Presses keys chosen from the game state, for unattended soak runs.
+ * 
+ * Before every wait for a key the game thread shows the bot the world; the
+ * bot picks its key right there (so it never reads the world from another
+ * thread) and the input thread sends it at most once per interval. In a
+ * game the bot hunts like the AI tuner's bot: it fires at an enemy in
+ * line of fire and otherwise closes in on the nearest one. On other
+ * screens it confirms, so games restart forever until the duration ends.
+ */
+class BotInputSource : public SyntheticInputSource {
+private:
+    std::mt19937 random;            ///< Fallback moves when blocked
+    int intervalMs;                 ///< Minimum pause between keys
+    std::string plannedKey;         ///< Key for the last observed state
+    unsigned long observation;      ///< Number of observed states
+    unsigned long sentObservation;  ///< Observation whose key was sent last
+    Clock::time_point lastSent;     ///< When the last key was sent
+
+    std::string chooseKey(const GameWorld& world);  ///< Picks key for a state (game thread)
+
+protected:
+    bool generate(Clock::time_point now, std::string& bytes, Clock::time_point& wakeAt) override;
+
+public:
+    /**
+     * @brief Constructs a bot.
+     * @param seed Seed of the bot's random choices.
+     * @param interval Minimum pause between keys in milliseconds.
+     * @returns None
+     */
+    BotInputSource(unsigned int seed, int interval);
+
+    void observe(const GameWorld& world) override;
+};
+
+#endif // BOTINPUTSOURCE_H
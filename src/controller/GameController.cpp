@@ -12,44 +12,133 @@
 #include "GameController.h"
 #include <ctime>
 #include <thread>
+#include <fstream>
+#include <cstdio>
+#include <iterator>
+#include <algorithm>
+
+namespace {
+
+const int DEFAULT_TICK_RATE = 8;    // Тиков в секунду в режиме реального времени
+const int MIN_TICK_RATE = 1;
+const int MAX_TICK_RATE = 60;
+const size_t MAX_QUEUED_MOVES = 4;  // Ходов в очереди при input_coalescing=queue
+const char* const QUICKSAVE_FILE = "quicksave.bin";
+const int SETTINGS_POLL_MS = 250;   // Как часто файл настроек проверяется, пока игра ждёт клавишу
+
+// Настройки, которые применяются к идущей игре, если их поменять в файле
+const char* const LIVE_SETTINGS[] = {
+    "theme", "game_mode", "tick_rate", "tick_policy", "input_coalescing", "debug_overlay"
+};
+
+bool isActionCommand(Command cmd) {
+    return cmd == Command::MOVE_UP || cmd == Command::MOVE_DOWN ||
+           cmd == Command::MOVE_LEFT || cmd == Command::MOVE_RIGHT ||
+           cmd == Command::FIRE;
+}
+
+}
 
 GameController::GameController(int width, int height) 
-    : model(width, height), view(), running(true), 
+    : model(width, height), view(), renderThread(view), running(true), 
       mapManager("../resources/maps"), currentMapIndex(0), 
-      scoreSaved(false), useCustomMap(false) {
+      scoreSaved(false), useCustomMap(false), realtime(false), tickRate(DEFAULT_TICK_RATE),
+      queueMoves(false), fireRequested(false), frameHasInput(false) {
     srand(static_cast<unsigned int>(time(nullptr)));
     mapManager.loadMaps();
 
-    bool advancedGraphics = settingsManager.getBoolSetting("advanced_graphics", true);
-    view.setAdvancedGraphics(advancedGraphics);
+    for (const char* key : LIVE_SETTINGS) {
+        applySetting(key);
+    }
+
+    // Правка файла настроек во время игры применяется без перезапуска
+    settingsManager.addListener([this](const std::string& key) { applySetting(key); });
+
+    // Бот выбирает клавиши по состоянию мира (с клавиатуры мир не нужен)
+    inputHandler.setWorld(&model);
+
+    // Задержки от нажатия до кадра: строка в отладочном оверлее и отчёт при выходе
+    renderThread.setLatencyStats(&latency);
+    view.setLatencyStats(&latency);
+    scheduler.setLatencyStats(&latency);
+
+    // Запись игровых кадров в файл asciicast, параллельно с выводом на экран
+    std::string recordPath = settingsManager.getSetting("record_file");
+    if (!recordPath.empty()) {
+        auto size = view.getSink()->getSize();
+        recorder.reset(new AsciicastSink(recordPath, size.first, size.second, view.getSink()));
+        if (recorder->isOpen()) {
+            view.setSink(recorder.get());
+        } else {
+            recorder.reset();
+        }
+    }
+}
+
+void GameController::applySetting(const std::string& key) {
+    // Отрисовщик меняем только когда поток отрисовки им не пользуется
+    if (key == "theme" || key == "advanced_graphics" || key == "debug_overlay") {
+        renderThread.drain();
+    }
+
+    if (key == "theme" || key == "advanced_graphics") {
+        // Тема из настроек; если её нет - старый флаг расширенной графики
+        std::string theme = settingsManager.getSetting("theme");
+        if (theme.empty() || !view.setTheme(theme)) {
+            bool advancedGraphics = settingsManager.getBoolSetting("advanced_graphics", true);
+            view.setAdvancedGraphics(advancedGraphics);
+        }
+    } else if (key == "game_mode") {
+        // Пошаговый режим по умолчанию; в реальном времени мир живёт по таймеру
+        realtime = settingsManager.getSetting("game_mode") == "realtime";
+        scheduler.restart();
+    } else if (key == "tick_rate") {
+        tickRate = std::max(MIN_TICK_RATE, std::min(MAX_TICK_RATE,
+                   settingsManager.getIntSetting("tick_rate", DEFAULT_TICK_RATE)));
+        scheduler.setRate(tickRate);
+        scheduler.restart();
+    } else if (key == "tick_policy") {
+        scheduler.setPolicy(settingsManager.getSetting("tick_policy") == "catch_up" ? TickPolicy::CATCH_UP
+                                                                                   : TickPolicy::SKIP);
+    } else if (key == "input_coalescing") {
+        queueMoves = settingsManager.getSetting("input_coalescing") == "queue";
+    } else if (key == "debug_overlay") {
+        // Строка со скоростью вывода и режимом отрисовки - для отладки медленных терминалов
+        view.setDebugOverlay(settingsManager.getBoolSetting("debug_overlay", false));
+    }
 }
 
 void GameController::toggleAdvancedGraphics() {
-    bool currentSetting = settingsManager.getBoolSetting("advanced_graphics", true);
-    bool newSetting = !currentSetting;
-    
-    settingsManager.setBoolSetting("advanced_graphics", newSetting);
-    view.setAdvancedGraphics(newSetting);
+    // Темы скомпилированы при запуске - переключение мгновенное,
+    // экран настроек сразу перерисуется с новой темой
+    view.nextTheme();
     
-    // Сообщаем пользователю о изменении
-    view.clearScreen();
-    std::cout << "Graphics mode changed: " 
-          << (newSetting ? "ADVANCED" : "SYMBOLIC") << std::endl;
-    PlatformUtils::sleep(1000);
+    settingsManager.setSetting("theme", view.getThemeName());
+    settingsManager.setBoolSetting("advanced_graphics", view.getAdvancedGraphics());
+}
+
+void GameController::toggleGameMode() {
+    realtime = !realtime;
+    settingsManager.setSetting("game_mode", realtime ? "realtime" : "turn");
+    settingsManager.setIntSetting("tick_rate", tickRate);
 }
 
 void GameController::handleTerminalResize() {
+    // Дальше экраном пользуется игровой поток
+    renderThread.drain();
+
     while (!view.checkTerminalSize() && running) {
         view.clearScreen();
         view.drawErrorMessage("Terminal size too small. Increase window size.");
+        std::cout.flush();
         
-        // Ждем некоторое время перед повторной проверкой
-        PlatformUtils::sleep(500);
-        
-        // Также проверяем команды пользователя во время ожидания
-        if (PlatformUtils::kbhit()) {
-            std::string input = PlatformUtils::readUTF8Char();
-            if (input == "q" || input == "Q" || input == "й" || input == "Й") {
+        // Спим до SIGWINCH или нажатия клавиши - без периодического опроса
+        InputEvent event;
+        if (waitForInput(event)) {
+            // EXIT приходит и без клавиши - когда ввод закончился
+            std::string input = event.key;
+            if (event.command == Command::EXIT ||
+                input == "q" || input == "Q" || input == "й" || input == "Й") {
                 running = false;
                 return;
             }
@@ -57,8 +146,27 @@ void GameController::handleTerminalResize() {
     }
 }
 
+bool GameController::waitForInput(InputEvent& event) {
+    // Поток ввода будит игру через условную переменную, дескриптор inotify к этому
+    // ожиданию не добавить - проверяем файл настроек между короткими ожиданиями
+    for (;;) {
+        event.resize = false;
+        if (inputHandler.waitForEvent(SETTINGS_POLL_MS, event)) return true;
+        if (event.resize) return false;
+
+        // Новая тема или режим видны сразу, а не после следующего нажатия
+        if (settingsManager.pollChanges()) return false;
+    }
+}
+
+Command GameController::waitForCommand() {
+    InputEvent event;
+    return waitForInput(event) ? event.command : Command::NONE;
+}
+
 void GameController::showMapSelection() {
     bool inMapSelection = true;
+    renderThread.drain();
     
     if (mapManager.getMapCount() == 0) {
         mapManager.loadMaps();
@@ -84,7 +192,12 @@ void GameController::showMapSelection() {
         }
         std::cout.flush();
         
-        std::string input = PlatformUtils::readUTF8Char();
+        // Смена размера терминала - перерисовываем выбор карты
+        InputEvent event;
+        if (!waitForInput(event)) {
+            continue;
+        }
+        std::string input = event.key;
         
         if (input == "a" || input == "A" || input == "ф" || input == "Ф") {
             // Предыдущая карта
@@ -119,8 +232,9 @@ void GameController::showMapSelection() {
             showMenu();
             return;
         }
-        else if (input == "q" || input == "Q" || input == "й" || input == "Й") {
-            // Выход
+        else if (event.command == Command::EXIT ||
+                 input == "q" || input == "Q" || input == "й" || input == "Й") {
+            // Выход, в том числе по концу ввода (пустая клавиша)
             running = false;
             inMapSelection = false;
         }
@@ -158,6 +272,10 @@ void GameController::loadSelectedMap() {
     }
 }
 
+void GameController::setInputSource(std::unique_ptr<InputSource> source) {
+    inputHandler.setSource(std::move(source));
+}
+
 void GameController::runGame() {
     if (!view.checkTerminalSize()) {
         int requiredWidth = model.getWidth();
@@ -167,12 +285,22 @@ void GameController::runGame() {
         return;
     }
 
-    showMenu();
-    while (running) {
-        processGameTurn(); 
+    PlatformUtils::installResizeHandler();
+    {
+        // Сырой режим терминала на всё время игры; восстанавливается и при сигналах
+        TerminalSession session;
+        renderThread.start();
+        inputHandler.start();
+
+        showMenu();
+        while (running) {
+            processGameTurn(); 
+        }
+
+        inputHandler.stop();
+        renderThread.stop();
     }
-    
-    view.clearScreen();
+    writeLatencyReport();
     std::cout << "Game completed. Thank you for playing!" << std::endl;
 }
 
@@ -191,7 +319,7 @@ void GameController::pauseGame() {
             }
             std::cout.flush();
             
-            Command cmd = inputHandler.waitForCommand();
+            Command cmd = waitForCommand();
             if (cmd == Command::PAUSE || cmd == Command::CONFIRM) {
                 model.setState(GameState::PLAYING);
                 paused = false;
@@ -214,19 +342,42 @@ void GameController::pauseGame() {
 }
 
 void GameController::processGameTurn() {
-    handleTerminalResize();
-    if (!running) return;
+    settingsManager.pollChanges();
+
+    // Во время игры размер терминала проверяет поток отрисовки;
+    // ждём здесь, только если он не смог нарисовать кадр
+    if (model.getState() != GameState::PLAYING || renderThread.hasFailed()) {
+        handleTerminalResize();
+        if (!running) return;
+    }
+
+    // Ход, показанный не игровым кадром (конец игры, уровня), в задержку кадра не попадает;
+    // время вне игры - не пропущенные тики, расписание начнётся заново
+    if (model.getState() != GameState::PLAYING) {
+        frameHasInput = false;
+        scheduler.restart();
+    }
 
-    view.clearScreen();
     int score = 0;
     
     switch (model.getState()) {
-        case GameState::PLAYING:
-            if (!view.render(model)) {
-                // Если рендер не удался из-за размера терминала, выходим из цикла
-                return;
+        case GameState::PLAYING: {
+            // Окно поля подстраивается под терминал и следует за игроком
+            auto capacity = ConsoleRenderer::getFieldCapacity(view.getSink()->getSize());
+            camera.resize(capacity.first, capacity.second, model.getWidth(), model.getHeight());
+            if (model.getPlayer()) {
+                camera.follow(model.getPlayer()->getPosition());
             }
+
+            // Снимок мира уходит потоку отрисовки, а игра сразу ждёт ввода
+            RenderSnapshot& frame = renderThread.beginFrame();
+            model.buildSnapshot(frame, camera.getX(), camera.getY(), camera.getWidth(), camera.getHeight());
+            frame.hasInput = frameHasInput;
+            frame.inputTime = frameInputTime;
+            frameHasInput = false;
+            renderThread.publish();
             break;
+        }
             
         case GameState::LEVEL_COMPLETE:
             showLevelCompleteScreen();
@@ -234,6 +385,7 @@ void GameController::processGameTurn() {
             
         case GameState::PAUSED:
             view.drawPauseScreen();
+            std::cout.flush();
             break;
             
         case GameState::GAME_OVER:
@@ -246,34 +398,127 @@ void GameController::processGameTurn() {
                 }
             }
             view.drawGameOver(model.getPlayer() ? model.getPlayer()->getScore() : 0);
+            std::cout.flush();
             break;
 
         default:
             break;
     }
     
-    std::cout.flush();
-    
     if (model.getState() == GameState::LEVEL_COMPLETE) {
         return;
     }
+
+    if (realtime && model.getState() == GameState::PLAYING) {
+        processRealtimeTick();
+        return;
+    }
     
-    Command cmd = inputHandler.waitForCommand();
+    InputEvent event;
+    Command cmd = waitForInput(event) ? event.command : Command::NONE;
+    std::chrono::steady_clock::time_point applied = std::chrono::steady_clock::now();
     processCommand(cmd);
     
-    if (model.getState() == GameState::PLAYING && 
-        (cmd == Command::MOVE_UP || cmd == Command::MOVE_DOWN || 
-         cmd == Command::MOVE_LEFT || cmd == Command::MOVE_RIGHT ||
-         cmd == Command::FIRE)) {
-        
+    if (model.getState() == GameState::PLAYING && isActionCommand(cmd)) {
+        trackInput(event, applied);
         model.update();
+        latency.record(LatencyStage::SIMULATION, std::chrono::steady_clock::now() - applied);
         
         if (model.getState() == GameState::GAME_OVER) {
+            renderThread.drain();
             view.drawGameOver(model.getPlayer()->getScore());
         }
     }
 }
 
+void GameController::processRealtimeTick() {
+    using clock = std::chrono::steady_clock;
+
+    // Разбираем очередь ввода до тика; действия копятся, остальное выполняется сразу
+    InputEvent event;
+    clock::time_point deadline = scheduler.getDeadline();
+    while (running) {
+        // Ждём ввода с точностью до миллисекунды, остаток досыпаем до точного срока
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - clock::now()).count();
+        if (remaining <= 0) break;
+        if (!inputHandler.waitForEvent(static_cast<int>(remaining), event)) continue;
+
+        if (event.command == Command::FIRE) {
+            if (!fireRequested) {
+                fireRequested = true;
+                fireEvent = event;
+            }
+        } else if (isActionCommand(event.command)) {
+            // По умолчанию из нескольких нажатий за тик действует последнее
+            if (!queueMoves) pendingMoves.clear();
+            if (pendingMoves.size() < MAX_QUEUED_MOVES) pendingMoves.push_back(event);
+        } else if (event.command != Command::NONE) {
+            pendingMoves.clear();
+            fireRequested = false;
+            processCommand(event.command);
+            // Пауза и меню - не опоздание тика
+            scheduler.restart();
+            return;
+        }
+    }
+    scheduler.sleepUntilDeadline();
+    int ticks = scheduler.beginTick();
+
+    // Ожидание тика входит в задержку очереди, сам тик - в задержку симуляции
+    clock::time_point tickTime = clock::now();
+    bool applied = false;
+    if (!pendingMoves.empty()) {
+        trackInput(pendingMoves.front(), tickTime);
+        processCommand(pendingMoves.front().command);
+        pendingMoves.pop_front();
+        applied = true;
+    }
+    if (fireRequested) {
+        trackInput(fireEvent, tickTime);
+        processCommand(Command::FIRE);
+        fireRequested = false;
+        applied = true;
+    }
+    model.update();
+    if (applied) {
+        latency.record(LatencyStage::SIMULATION, clock::now() - tickTime);
+    }
+
+    // Догоняем пропущенные тики без ввода (только при tick_policy=catch_up)
+    for (int i = 1; i < ticks && model.getState() == GameState::PLAYING; i++) {
+        model.update();
+    }
+
+    if (model.getState() == GameState::GAME_OVER) {
+        renderThread.drain();
+        view.drawGameOver(model.getPlayer()->getScore());
+    }
+}
+
+void GameController::trackInput(const InputEvent& event, std::chrono::steady_clock::time_point applied) {
+    latency.record(LatencyStage::DECODE, event.decodedTime - event.time);
+    latency.record(LatencyStage::QUEUE, applied - event.decodedTime);
+
+    // Кадр, впервые показывающий несколько нажатий, измеряется от самого раннего
+    if (!frameHasInput || event.time < frameInputTime) {
+        frameInputTime = event.time;
+    }
+    frameHasInput = true;
+}
+
+void GameController::writeLatencyReport() {
+    std::string path = settingsManager.getSetting("latency_report");
+    if (path.empty()) return;
+
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Cannot write latency report to " << path << std::endl;
+        return;
+    }
+    latency.report(file);
+    file << "skipped ticks: " << scheduler.getSkippedTicks() << "\n";
+}
+
 void GameController::processCommand(Command cmd) {
     switch (cmd) {
         case Command::MOVE_UP:
@@ -379,11 +624,53 @@ void GameController::processCommand(Command cmd) {
             running = false;
             break;
             
+        case Command::QUICK_SAVE:
+            if (model.getState() == GameState::PLAYING) {
+                quickSave();
+            }
+            break;
+
+        case Command::QUICK_LOAD:
+            if (model.getState() == GameState::PLAYING) {
+                quickLoad();
+            }
+            break;
+
         case Command::NONE:
             break;
     }
 }
 
+void GameController::quickSave() {
+    std::vector<char> data;
+    model.saveState(data);
+
+    // Пишем рядом и подменяем: прерванная запись не испортит прошлое сохранение
+    std::string tempPath = std::string(QUICKSAVE_FILE) + ".tmp";
+    std::ofstream file(tempPath, std::ios::binary);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    file.close();
+
+    // Ошибка записи или закрытия - прошлое сохранение не трогаем
+    if (!file.good() || !PlatformUtils::replaceFile(tempPath, QUICKSAVE_FILE)) {
+        std::remove(tempPath.c_str());
+    }
+}
+
+void GameController::quickLoad() {
+    std::ifstream file(QUICKSAVE_FILE, std::ios::binary);
+    if (!file) return;
+
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!model.loadState(data)) return;
+
+    // Восстановленная игра - не продолжение текущей: накопленный ввод и расписание тиков сбрасываем
+    pendingMoves.clear();
+    fireRequested = false;
+    frameHasInput = false;
+    scheduler.restart();
+}
+
 void GameController::showMenu() {
     model.setState(GameState::MENU);
     bool inMenu = true;
@@ -423,7 +710,7 @@ void GameController::showMenu() {
         
         std::cout.flush();
         
-        Command cmd = inputHandler.waitForCommand();
+        Command cmd = waitForCommand();
         switch (cmd) {
             case Command::CONFIRM:
                 // Сбрасываем флаг при начале новой игры
@@ -459,13 +746,13 @@ void GameController::showSettings() {
         if (!running) return;
 
         view.clearScreen();
-        if (!view.drawSettings()) {
+        if (!view.drawSettings(realtime, tickRate)) {
             continue;
         }
         
         std::cout.flush();
         
-        Command cmd = inputHandler.waitForCommand();
+        Command cmd = waitForCommand();
         switch (cmd) {
             case Command::BACK:
                 inSettings = false;
@@ -478,6 +765,9 @@ void GameController::showSettings() {
             case Command::FIRE:
                 toggleAdvancedGraphics();
                 break;
+            case Command::PAUSE:
+                toggleGameMode();
+                break;
             
             default:
                 break;
@@ -527,7 +817,7 @@ void GameController::showLevelCompleteScreen() {
         }
         std::cout.flush();
         
-        Command cmd = inputHandler.waitForCommand();
+        Command cmd = waitForCommand();
         switch (cmd) {
             case Command::CONFIRM:
                 // Сохраняем рекорд при переходе на следующий уровень через меню
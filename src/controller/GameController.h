@@ -17,13 +17,21 @@
 #include "../utils/MapManager.h"
 #include "../utils/ScoreManager.h"
 #include "../view/ConsoleRenderer.h"
+#include "../view/RenderThread.h"
+#include "../view/Camera.h"
 #include "../utils/SettingsManager.h"
+#include "../utils/TerminalSession.h"
+#include "../utils/LatencyStats.h"
+#include "../utils/TickScheduler.h"
 
 #include <map>
+#include <deque>
+#include <memory>
 #include <vector>
 #include <iostream>
 #include <string>
 #include <ctime>
+#include <chrono>
 
 /**
  * @brief Main game controller class that manages the game flow and logic.
@@ -35,6 +43,9 @@ class GameController {
 private:
     GameWorld model;               ///< Game model containing world state and logic
     ConsoleRenderer view;          ///< View component for rendering
+    std::unique_ptr<AsciicastSink> recorder; ///< Session recording, if enabled in settings
+    RenderThread renderThread;     ///< Presents game frames off the game thread
+    Camera camera;                 ///< Visible window of fields larger than the terminal
     InputHandler inputHandler;     ///< Input handler for user commands
     ScoreManager scoreManager;     ///< Manager for high scores
     bool running;                  ///< Flag indicating if game is running
@@ -45,12 +56,65 @@ private:
     
     MapInfo selectedMap;           ///< Currently selected map information
 
+    bool realtime;                 ///< Simulation advances on a timer instead of on player moves
+    int tickRate;                  ///< Simulation ticks per second in real-time mode
+    TickScheduler scheduler;       ///< Deadlines of real-time ticks
+    bool queueMoves;               ///< Real-time: moves are queued one per tick instead of last-wins
+    std::deque<InputEvent> pendingMoves; ///< Real-time moves waiting for a tick
+    bool fireRequested;            ///< Real-time fire request waiting for a tick
+    InputEvent fireEvent;          ///< Pending real-time fire key
+    LatencyStats latency;          ///< Key-to-frame latency histograms
+    bool frameHasInput;            ///< Next published frame shows the effect of a key
+    std::chrono::steady_clock::time_point frameInputTime; ///< When the oldest key shown by the next frame was read
+
+    /**
+     * @brief Records decode and queue latency of a key being applied.
+     * 
+     * The next published frame is marked as showing the key, so the render
+     * thread can measure the end-to-end delay.
+     * @param event Key event.
+     * @param applied When the game thread started applying the key.
+     * @returns None
+     */
+    void trackInput(const InputEvent& event, std::chrono::steady_clock::time_point applied);
+
+    /**
+     * @brief Writes latency histograms to the file named by the latency_report setting.
+     * @returns None
+     */
+    void writeLatencyReport();
+
     /**
      * @brief Processes a single game turn/update cycle.
      * @returns None
      */
     void processGameTurn();
     
+    /**
+     * @brief Waits for the next real-time tick, then advances the simulation.
+     * 
+     * Input events arriving before the deadline are drained without blocking
+     * past it. Moves are coalesced (the last one wins, or with
+     * input_coalescing=queue one queued move per tick), a fire request is
+     * kept until a tick applies it; other commands are handled at once and
+     * end the wait. Ticks missed while the game was busy are dropped or run
+     * back to back, as the tick_policy setting says.
+     * @returns None
+     */
+    void processRealtimeTick();
+
+    /**
+     * @brief Writes the game in progress to the quick-save file.
+     * @returns None
+     */
+    void quickSave();
+
+    /**
+     * @brief Replaces the game in progress with the quick-save file, if it is valid.
+     * @returns None
+     */
+    void quickLoad();
+
     /**
      * @brief Processes a user command.
      * @param cmd Command to process.
@@ -97,17 +161,50 @@ private:
     SettingsManager settingsManager;  ///< Manager for game settings
     
     /**
-     * @brief Toggles between advanced and symbolic graphics modes.
+     * @brief Switches to the next glyph theme (advanced, symbolic, user themes).
      * @returns None
      */
     void toggleAdvancedGraphics();
 
+    /**
+     * @brief Applies a setting to the running game.
+     * 
+     * Called at startup and whenever the key changes, in the game or in the settings file.
+     * @param key Setting key.
+     * @returns None
+     */
+    void applySetting(const std::string& key);
+
+    /**
+     * @brief Switches between turn-based and real-time modes and saves the choice.
+     * @returns None
+     */
+    void toggleGameMode();
+
     /**
      * @brief Handles terminal resize events.
+     * 
+     * Drains the render thread first, so the caller may draw directly afterwards.
      * @returns None
      */
     void handleTerminalResize();
 
+    /**
+     * @brief Waits for a key, applying edits of the settings file meanwhile.
+     * 
+     * Returns false on terminal resize or when a setting changed, so callers
+     * redraw their screen.
+     * @param event Receives the key event.
+     * @return true if a key was pressed, false otherwise.
+     */
+    bool waitForInput(InputEvent& event);
+
+    /**
+     * @brief Waits for a command, applying edits of the settings file meanwhile.
+     * @return Detected command, or Command::NONE on resize or a changed setting.
+     */
+    Command waitForCommand();
+
 public:
     /**
      * @brief Constructs a GameController object.
@@ -117,6 +214,13 @@ public:
      */
     GameController(int width, int height);
     
+    /**
+     * @brief Replaces keyboard input with a key script or a bot (call before runGame()).
+     * @param source New source of keys.
+     * @returns None
+     */
+    void setInputSource(std::unique_ptr<InputSource> source);
+
     /**
      * @brief Starts and runs the main game loop.
      * @returns None
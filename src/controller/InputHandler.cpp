@@ -11,7 +11,21 @@
 
 #include "InputHandler.h"
 
-InputHandler::InputHandler() {
+const int InputEvent::MAX_KEY_BYTES;
+const size_t InputHandler::QUEUE_SIZE;
+const unsigned InputHandler::BINDING_CODEPOINTS;
+const int InputHandler::ARROW_KEYS;
+
+InputHandler::InputHandler()
+    : source(new TerminalInputSource()), world(nullptr), stopping(false), dropped(0), inputClosed(false) {
+    for (Command& binding : keyBindings) {
+        binding = Command::NONE;
+    }
+    arrowBindings[0] = Command::MOVE_UP;
+    arrowBindings[1] = Command::MOVE_DOWN;
+    arrowBindings[2] = Command::MOVE_LEFT;
+    arrowBindings[3] = Command::MOVE_RIGHT;
+
     keyBindings['w'] = Command::MOVE_UP;
     keyBindings['W'] = Command::MOVE_UP;
     keyBindings['s'] = Command::MOVE_DOWN;
@@ -31,103 +45,255 @@ InputHandler::InputHandler() {
     keyBindings[27] = Command::BACK; // Escape
     keyBindings['q'] = Command::EXIT;
     keyBindings['Q'] = Command::EXIT;
+    keyBindings['k'] = Command::QUICK_SAVE;
+    keyBindings['K'] = Command::QUICK_SAVE;
+    keyBindings['l'] = Command::QUICK_LOAD;
+    keyBindings['L'] = Command::QUICK_LOAD;
 
     // Привязки для кириллицы (UTF-8)
-    utf8KeyBindings["ц"] = Command::MOVE_UP;      // w -> ц
-    utf8KeyBindings["Ц"] = Command::MOVE_UP;      // W -> Ц
-    utf8KeyBindings["ы"] = Command::MOVE_DOWN;    // s -> ы
-    utf8KeyBindings["Ы"] = Command::MOVE_DOWN;    // S -> Ы
-    utf8KeyBindings["ф"] = Command::MOVE_LEFT;    // a -> ф
-    utf8KeyBindings["Ф"] = Command::MOVE_LEFT;    // A -> Ф
-    utf8KeyBindings["в"] = Command::MOVE_RIGHT;   // d -> в
-    utf8KeyBindings["В"] = Command::MOVE_RIGHT;   // D -> В
-    utf8KeyBindings["а"] = Command::FIRE;         // f -> а
-    utf8KeyBindings["А"] = Command::FIRE;         // F -> А
-    utf8KeyBindings["з"] = Command::PAUSE;        // p -> з
-    utf8KeyBindings["З"] = Command::PAUSE;        // P -> З
-    utf8KeyBindings["ь"] = Command::MENU;         // m -> ь
-    utf8KeyBindings["Ь"] = Command::MENU;         // M -> Ь
-    utf8KeyBindings["й"] = Command::EXIT;         // q -> й
-    utf8KeyBindings["Й"] = Command::EXIT;         // Q -> Й
+    remapUTF8Key("ц", Command::MOVE_UP);      // w -> ц
+    remapUTF8Key("Ц", Command::MOVE_UP);      // W -> Ц
+    remapUTF8Key("ы", Command::MOVE_DOWN);    // s -> ы
+    remapUTF8Key("Ы", Command::MOVE_DOWN);    // S -> Ы
+    remapUTF8Key("ф", Command::MOVE_LEFT);    // a -> ф
+    remapUTF8Key("Ф", Command::MOVE_LEFT);    // A -> Ф
+    remapUTF8Key("в", Command::MOVE_RIGHT);   // d -> в
+    remapUTF8Key("В", Command::MOVE_RIGHT);   // D -> В
+    remapUTF8Key("а", Command::FIRE);         // f -> а
+    remapUTF8Key("А", Command::FIRE);         // F -> А
+    remapUTF8Key("з", Command::PAUSE);        // p -> з
+    remapUTF8Key("З", Command::PAUSE);        // P -> З
+    remapUTF8Key("ь", Command::MENU);         // m -> ь
+    remapUTF8Key("Ь", Command::MENU);         // M -> Ь
+    remapUTF8Key("й", Command::EXIT);         // q -> й
+    remapUTF8Key("Й", Command::EXIT);         // Q -> Й
+    remapUTF8Key("л", Command::QUICK_SAVE);   // k -> л
+    remapUTF8Key("Л", Command::QUICK_SAVE);   // K -> Л
+    remapUTF8Key("д", Command::QUICK_LOAD);   // l -> д
+    remapUTF8Key("Д", Command::QUICK_LOAD);   // L -> Д
 }
 
-Command InputHandler::waitForCommand() {
-    std::string input = PlatformUtils::readUTF8Char();
-    
-#ifdef _WIN32
-    if (input.length() == 1) {
-        int key = static_cast<unsigned char>(input[0]);
-        
-        if (key == 0 || key == 224) {
-            int specialKey = PlatformUtils::readUTF8Char()[0];
-            switch (specialKey) {
-                case 72: // Стрелка вверх
-                    return Command::MOVE_UP;
-                case 80: // Стрелка вниз
-                    return Command::MOVE_DOWN;
-                case 75: // Стрелка влево
-                    return Command::MOVE_LEFT;
-                case 77: // Стрелка вправо
-                    return Command::MOVE_RIGHT;
-                default:
-                    return Command::NONE;
-            }
+InputHandler::~InputHandler() {
+    stop();
+}
+
+void InputHandler::setSource(std::unique_ptr<InputSource> input) {
+    source = std::move(input);
+}
+
+void InputHandler::setWorld(const GameWorld* observed) {
+    world = observed;
+}
+
+void InputHandler::start() {
+    if (reader.joinable()) return;
+    stopping = false;
+    reader = std::thread(&InputHandler::run, this);
+}
+
+void InputHandler::stop() {
+    if (!reader.joinable()) return;
+    stopping = true;
+    source->interrupt();
+    reader.join();
+}
+
+void InputHandler::run() {
+    unsigned seenResize = PlatformUtils::getResizeGeneration();
+
+    while (!stopping) {
+        InputEvent event;
+        unsigned generation = PlatformUtils::getResizeGeneration();
+        if (generation != seenResize) {
+            // Смену размера проверяем до чтения: она могла прийти и во время разбора последовательности
+            seenResize = generation;
+            event.command = Command::NONE;
+            event.key[0] = '\0';
+            event.resize = true;
+            event.closed = false;
+            event.time = std::chrono::steady_clock::now();
+            event.decodedTime = event.time;
+        } else if (!readEvent(-1, event)) {
+            // Тайм-аут, пробуждение для остановки или смена размера (обработается в начале цикла)
+            continue;
+        }
+
+        if (!events.push(event) && !event.closed) {
+            dropped++;
+            continue;
         }
-        
-        auto it = keyBindings.find(key);
-        if (it != keyBindings.end()) {
-            return it->second;
+        {
+            // Пустая критическая секция: ожидающий поток не пропустит уведомление.
+            // Если EXIT не влез в очередь, его выдаст waitForEvent по флагу
+            std::lock_guard<std::mutex> lock(mutex);
+            if (event.closed) inputClosed = true;
         }
+        arrived.notify_one();
+
+        // Читать больше нечего - поток завершается
+        if (event.closed) break;
     }
-#else
-    if (input.length() == 1 && static_cast<unsigned char>(input[0]) == 27) {
-        if (PlatformUtils::kbhit()) {
-            std::string secondChar = PlatformUtils::readUTF8Char();
-            if (secondChar == "[") {
-                if (PlatformUtils::kbhit()) {
-                    std::string thirdChar = PlatformUtils::readUTF8Char();
-                    if (thirdChar.length() == 1) {
-                        switch (static_cast<unsigned char>(thirdChar[0])) {
-                            case 65: // Стрелка вверх
-                                return Command::MOVE_UP;
-                            case 66: // Стрелка вниз
-                                return Command::MOVE_DOWN;
-                            case 68: // Стрелка влево
-                                return Command::MOVE_LEFT;
-                            case 67: // Стрелка вправо
-                                return Command::MOVE_RIGHT;
-                            default:
-                                return Command::NONE;
-                        }
-                    }
-                }
+}
+
+bool InputHandler::readKey(int timeoutMs, Key& key, bool& closed) {
+    closed = false;
+
+    while (!decoder.next(key)) {
+        if (decoder.isPending()) {
+            // Остаток последовательности приходит сразу; если его нет - был нажат одиночный ESC
+            if (!source->waitForInput(KeyDecoder::ESCAPE_TIMEOUT_MS)) {
+                decoder.timeout();
+                continue;
             }
+        } else if (!source->waitForInput(timeoutMs)) {
+#ifdef _WIN32
+            // Уведомлений о смене размера нет - без тайм-аута просто ждём клавишу
+            if (timeoutMs < 0) continue;
+#endif
+            return false;
         }
-        return Command::BACK;
-    }
-    
-    if (input.length() == 1) {
-        int key = static_cast<unsigned char>(input[0]);
-        auto it = keyBindings.find(key);
-        if (it != keyBindings.end()) {
-            return it->second;
+
+        int byte = source->readByte();
+        if (!decoder.isPending()) {
+            // Задержка клавиши отсчитывается от её первого байта
+            keyStart = std::chrono::steady_clock::now();
+        }
+        if (byte < 0) {
+            closed = true;
+            return true;
+        }
+#ifdef _WIN32
+        if ((byte == 0 || byte == 224) && !decoder.isPending()) {
+            // Стрелки консоли Windows: префикс и код клавиши
+            switch (source->readByte()) {
+                case 72: key.code = KeyCode::UP; break;
+                case 80: key.code = KeyCode::DOWN; break;
+                case 75: key.code = KeyCode::LEFT; break;
+                case 77: key.code = KeyCode::RIGHT; break;
+                default: continue;
+            }
+            key.codepoint = 0;
+            return true;
         }
-    }
 #endif
-    auto utf8It = utf8KeyBindings.find(input);
-    if (utf8It != utf8KeyBindings.end()) {
-        return utf8It->second;
+        decoder.feed(static_cast<unsigned char>(byte));
+    }
+    return true;
+}
+
+Command InputHandler::translate(const Key& key) const {
+    switch (key.code) {
+        case KeyCode::CHARACTER:
+            return key.codepoint < BINDING_CODEPOINTS ? keyBindings[key.codepoint] : Command::NONE;
+        case KeyCode::UP: return arrowBindings[0];
+        case KeyCode::DOWN: return arrowBindings[1];
+        case KeyCode::LEFT: return arrowBindings[2];
+        case KeyCode::RIGHT: return arrowBindings[3];
+        case KeyCode::ESCAPE: return keyBindings[27];
     }
-    
     return Command::NONE;
 }
 
+bool InputHandler::readEvent(int timeoutMs, InputEvent& event) {
+    event.command = Command::NONE;
+    event.key[0] = '\0';
+    event.resize = false;
+    event.closed = false;
+
+    Key key;
+    bool closed;
+    bool pressed = readKey(timeoutMs, key, closed);
+    event.decodedTime = std::chrono::steady_clock::now();
+    event.time = pressed ? keyStart : event.decodedTime;
+    if (!pressed) {
+#ifndef _WIN32
+        // Смена размера терминала прерывает ожидание, чтобы экран перерисовался сразу
+        event.resize = true;
+#endif
+        return false;
+    }
+
+    if (closed) {
+        // Конец ввода (терминал закрыт) - выходим из игры
+        event.command = Command::EXIT;
+        event.closed = true;
+        return true;
+    }
+
+    event.command = translate(key);
+    if (key.code == KeyCode::CHARACTER) {
+        int size = KeyDecoder::encodeUTF8(key.codepoint, event.key);
+        event.key[size] = '\0';
+    } else {
+        event.key[0] = '\033';
+        event.key[1] = '\0';
+    }
+    return true;
+}
+
+bool InputHandler::waitForEvent(int timeoutMs, InputEvent& event) {
+    if (world) {
+        // Сценарий или бот смотрят на мир здесь, в игровом потоке
+        source->observe(*world);
+    }
+
+    if (!reader.joinable()) {
+        return readEvent(timeoutMs, event);
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto ready = [this] { return !events.empty() || inputClosed; };
+    if (timeoutMs < 0) {
+        arrived.wait(lock, ready);
+    } else if (!arrived.wait_for(lock, std::chrono::milliseconds(timeoutMs), ready)) {
+        return false;
+    }
+    lock.unlock();
+
+    if (!events.pop(event)) {
+        // Поток ввода завершился: ждать нечего, каждое ожидание - выход из игры
+        event.command = Command::EXIT;
+        event.key[0] = '\0';
+        event.resize = false;
+        event.closed = true;
+        event.time = std::chrono::steady_clock::now();
+        event.decodedTime = event.time;
+        return true;
+    }
+    return !event.resize;
+}
+
+unsigned long InputHandler::getDroppedEvents() const {
+    return dropped;
+}
+
+Command InputHandler::waitForCommand() {
+    InputEvent event;
+    return waitForEvent(-1, event) ? event.command : Command::NONE;
+}
+
+Command InputHandler::pollCommand(int timeoutMs) {
+    InputEvent event;
+    return waitForEvent(timeoutMs, event) ? event.command : Command::NONE;
+}
+
 void InputHandler::remapKey(int keyCode, Command command) {
-    keyBindings[keyCode] = command;
+    if (keyCode >= 0 && static_cast<unsigned>(keyCode) < BINDING_CODEPOINTS) {
+        keyBindings[keyCode] = command;
+    }
 }
 
 void InputHandler::remapUTF8Key(const std::string& utf8Char, Command command) {
-    utf8KeyBindings[utf8Char] = command;
+    // Отдельный декодер: у основного может быть недочитанная последовательность
+    KeyDecoder characterDecoder;
+    for (char byte : utf8Char) {
+        characterDecoder.feed(static_cast<unsigned char>(byte));
+    }
+
+    Key key;
+    if (characterDecoder.next(key) && key.code == KeyCode::CHARACTER && key.codepoint < BINDING_CODEPOINTS) {
+        keyBindings[key.codepoint] = command;
+    }
 }
 
 int InputHandler::getKeyCode(char c) {
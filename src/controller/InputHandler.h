@@ -13,9 +13,17 @@
 #define INPUTHANDLER_H
 
 #include "../utils/PlatformUtils.h"
+#include "../utils/SpscRing.h"
+#include "KeyDecoder.h"
+#include "InputSource.h"
 
-#include <map>
 #include <string>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  * @brief Enumeration representing all possible user commands.
@@ -31,19 +39,66 @@ enum class Command {
     CONFIRM,      ///< Confirm selection/action
     BACK,         ///< Go back/exit current screen
     EXIT,         ///< Exit game
+    QUICK_SAVE,   ///< Save the game in progress to the quick-save file
+    QUICK_LOAD,   ///< Restore the game from the quick-save file
     NONE          ///< No command/unknown input
 };
 
+/**
+ * @brief Key press decoded by the input thread.
+ */
+struct InputEvent {
+    static const int MAX_KEY_BYTES = 8;     ///< Capacity of key text
+
+    Command command;            ///< Command bound to the key, NONE if unbound
+    char key[MAX_KEY_BYTES];    ///< UTF-8 text of the key (ESC for Escape and arrow keys)
+    bool resize;                ///< Terminal was resized, no key was pressed
+    bool closed;                ///< Input ended (terminal closed), command is EXIT
+    std::chrono::steady_clock::time_point time; ///< When the first byte of the key was read from the terminal
+    std::chrono::steady_clock::time_point decodedTime; ///< When the key was decoded
+};
+
 /**
  * @brief Class for handling user input and mapping it to game commands.
  * 
  * Supports both ASCII and UTF-8 input, including Cyrillic characters.
  * Handles special keys like arrow keys and provides key remapping functionality.
+ * Bytes are decoded by a KeyDecoder and bindings are looked up in flat
+ * tables indexed by codepoint, so translating a key is a single array access.
+ * 
+ * Once started, a dedicated thread reads and decodes keys as soon as they
+ * arrive, timestamps them and queues them in a lock-free ring, so keys typed
+ * while the game thread is busy are neither late nor lost. Without the
+ * thread, keys are read on the calling thread.
+ * 
+ * Bytes come from the terminal unless another InputSource (a key script or
+ * a bot) is set, which lets the game run unattended.
  */
 class InputHandler {
 private:
-    std::map<int, Command> keyBindings;          ///< ASCII key bindings
-    std::map<std::string, Command> utf8KeyBindings;  ///< UTF-8 key bindings
+    static const size_t QUEUE_SIZE = 64;        ///< Events buffered for the game thread
+    static const unsigned BINDING_CODEPOINTS = 0x500;   ///< Bindable codepoints: Latin and Cyrillic
+    static const int ARROW_KEYS = 4;            ///< Number of arrow keys
+
+    Command keyBindings[BINDING_CODEPOINTS];    ///< Character bindings indexed by codepoint
+    Command arrowBindings[ARROW_KEYS];          ///< Arrow bindings: up, down, left, right
+    std::unique_ptr<InputSource> source;        ///< Where key bytes come from
+    const GameWorld* world;                     ///< World shown to the source before waits, may be null
+    KeyDecoder decoder;                         ///< Decoder of bytes read on the input thread
+    std::chrono::steady_clock::time_point keyStart; ///< When the first byte of the key being decoded was read
+
+    SpscRing<InputEvent, QUEUE_SIZE> events;    ///< Events from the input thread to the game thread
+    std::thread reader;                         ///< Input thread
+    std::mutex mutex;                           ///< Pairs with arrived (the ring itself is lock-free)
+    std::condition_variable arrived;            ///< Signals a queued event
+    std::atomic<bool> stopping;                 ///< Input thread should exit
+    std::atomic<unsigned long> dropped;         ///< Events lost because the ring was full
+    std::atomic<bool> inputClosed;              ///< Input ended and the input thread has exited
+
+    bool readKey(int timeoutMs, Key& key, bool& closed); ///< Reads bytes until a key is decoded
+    Command translate(const Key& key) const;    ///< Looks up the command bound to a key
+    bool readEvent(int timeoutMs, InputEvent& event); ///< Waits for and decodes a key on the calling thread
+    void run();                                 ///< Input thread body
 
 public:
     /**
@@ -51,15 +106,82 @@ public:
      * @returns None
      */
     InputHandler();
+
+    /**
+     * @brief Stops the input thread.
+     * @returns None
+     */
+    ~InputHandler();
+
+    /**
+     * @brief Replaces the terminal as the source of keys (call before start()).
+     * @param input New source.
+     * @returns None
+     */
+    void setSource(std::unique_ptr<InputSource> input);
+
+    /**
+     * @brief Sets world the source observes before every wait (game thread).
+     * @param observed Game world (not owned), or nullptr.
+     * @returns None
+     */
+    void setWorld(const GameWorld* observed);
+
+    /**
+     * @brief Starts the input thread.
+     * 
+     * Call once the terminal is in raw mode; from then on only the input
+     * thread reads the terminal.
+     * @returns None
+     */
+    void start();
+
+    /**
+     * @brief Stops the input thread and waits for it to exit.
+     * @returns None
+     */
+    void stop();
+
+    /**
+     * @brief Waits for the next key event.
+     * 
+     * A terminal resize ends the wait early and returns false, so callers
+     * redraw their screen for the new size. Once input has ended (the
+     * terminal was closed), this wait and every later one return EXIT at once.
+     * @param timeoutMs Maximum wait in milliseconds, -1 to wait without limit.
+     * @param event Receives the key event.
+     * @return true if a key was pressed, false on timeout or resize.
+     */
+    bool waitForEvent(int timeoutMs, InputEvent& event);
+
+    /**
+     * @brief Gets number of key events dropped because the game thread fell behind.
+     * @return Dropped event count.
+     */
+    unsigned long getDroppedEvents() const;
     
     /**
      * @brief Waits for and returns a user command.
+     * 
+     * A terminal resize ends the wait early with Command::NONE, so callers
+     * redraw their screen for the new size.
      * @return Detected command from user input.
      */
     Command waitForCommand();
+
+    /**
+     * @brief Returns a command if a key arrives within the timeout.
+     * 
+     * Never blocks past the timeout, so it can be used between timed events.
+     * @param timeoutMs Maximum wait in milliseconds, 0 to only check.
+     * @return Detected command, or Command::NONE on timeout or resize.
+     */
+    Command pollCommand(int timeoutMs);
     
     /**
      * @brief Remaps an ASCII key to a command.
+     * 
+     * Key code 27 binds the Escape key.
      * @param keyCode ASCII key code to remap.
      * @param command Command to assign to the key.
      * @returns None
@@ -68,6 +190,8 @@ public:
     
     /**
      * @brief Remaps a UTF-8 character to a command.
+     * 
+     * Characters outside the Latin and Cyrillic ranges cannot be bound and are ignored.
      * @param utf8Char UTF-8 character string to remap.
      * @param command Command to assign to the character.
      * @returns None
@@ -0,0 +1,97 @@
+/**
+ * @file InputSource.cpp
+ * @author Vld251
+ * @brief Implementation of terminal and generated key sources.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "InputSource.h"
+#include "../utils/PlatformUtils.h"
+
+bool TerminalInputSource::waitForInput(int timeoutMs) {
+    return PlatformUtils::waitForInputOrResize(timeoutMs);
+}
+
+int TerminalInputSource::readByte() {
+    return PlatformUtils::readByte();
+}
+
+void TerminalInputSource::interrupt() {
+    PlatformUtils::interruptInputWait();
+}
+
+SyntheticInputSource::SyntheticInputSource()
+    : position(0), finished(false), interrupted(false), endTime(Clock::time_point::max()) {}
+
+void SyntheticInputSource::finish() {
+    finished = true;
+}
+
+void SyntheticInputSource::setDuration(int seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    endTime = seconds > 0 ? Clock::now() + std::chrono::seconds(seconds) : Clock::time_point::max();
+}
+
+bool SyntheticInputSource::waitForInput(int timeoutMs) {
+    std::unique_lock<std::mutex> lock(mutex);
+    Clock::time_point deadline = timeoutMs < 0 ? Clock::time_point::max()
+                                               : Clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    while (true) {
+        // Конец ввода тоже "готов к чтению": readByte сообщит о нём
+        if (position < pending.size() || finished) return true;
+        if (interrupted) {
+            interrupted = false;
+            return false;
+        }
+
+        Clock::time_point now = Clock::now();
+        if (now >= endTime) {
+            finish();
+            continue;
+        }
+
+        Clock::time_point wakeAt = endTime;
+        std::string bytes;
+        if (generate(now, bytes, wakeAt)) {
+            pending.swap(bytes);
+            position = 0;
+            continue;
+        }
+        // Сценарий мог закончиться внутри generate() - тогда ждать больше нечего
+        if (finished) continue;
+        if (now >= deadline) return false;
+
+        Clock::time_point until = wakeAt < deadline ? wakeAt : deadline;
+        if (until == Clock::time_point::max()) {
+            changed.wait(lock);
+        } else {
+            changed.wait_until(lock, until);
+        }
+    }
+}
+
+int SyntheticInputSource::readByte() {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (position < pending.size()) {
+                return static_cast<unsigned char>(pending[position++]);
+            }
+            if (finished) return -1;
+        }
+        waitForInput(-1);
+    }
+}
+
+void SyntheticInputSource::interrupt() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        interrupted = true;
+    }
+    changed.notify_all();
+}
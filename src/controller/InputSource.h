@@ -0,0 +1,133 @@
+/**
+ * @file InputSource.h
+ * @author Vld251
+ * @brief Sources of key bytes: the terminal or generated input.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef INPUTSOURCE_H
+#define INPUTSOURCE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+class GameWorld;
+
+/**
+ * @brief Byte stream InputHandler decodes keys from.
+ * 
+ * waitForInput, readByte and interrupt are called by the input thread (or
+ * by the game thread when the input thread is not running); observe is
+ * always called by the game thread.
+ */
+class InputSource {
+public:
+    /**
+     * @brief Destroys the source.
+     * @returns None
+     */
+    virtual ~InputSource() {}
+
+    /**
+     * @brief Waits until a byte can be read, the wait is interrupted or the timeout passes.
+     * @param timeoutMs Maximum wait in milliseconds, -1 to wait without limit.
+     * @return true if readByte will not block, false on timeout, interruption or resize.
+     */
+    virtual bool waitForInput(int timeoutMs) = 0;
+
+    /**
+     * @brief Reads one byte, blocking until it arrives.
+     * @return Byte value 0-255, or -1 at end of input.
+     */
+    virtual int readByte() = 0;
+
+    /**
+     * @brief Wakes a thread blocked in waitForInput.
+     * @returns None
+     */
+    virtual void interrupt() = 0;
+
+    /**
+     * @brief Lets the source look at the world before the game waits for a key.
+     * @param world Current game world.
+     * @returns None
+     */
+    virtual void observe(const GameWorld& world) { (void)world; }
+};
+
+/**
+ * @brief Keys typed on the terminal (the default source).
+ */
+class TerminalInputSource : public InputSource {
+public:
+    bool waitForInput(int timeoutMs) override;
+    int readByte() override;
+    void interrupt() override;
+};
+
+/**
+ * @brief Base of sources producing keys by themselves instead of a keyboard.
+ * 
+ * Subclasses generate batches of key bytes, each with the moment it is due;
+ * the base paces them, supports interruption and ends input once the
+ * optional duration passes. Generated bytes go through the same decoder as
+ * typed ones, so escape sequences and UTF-8 are exercised too.
+ */
+class SyntheticInputSource : public InputSource {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+private:
+    std::string pending;        ///< Generated bytes not read yet
+    size_t position;            ///< Next byte of pending
+    bool finished;              ///< Input has ended
+    bool interrupted;           ///< interrupt() was called since the last wait
+    Clock::time_point endTime;  ///< When input ends regardless of the generator
+
+protected:
+    std::mutex mutex;                   ///< Guards generator state of this object and subclasses
+    std::condition_variable changed;    ///< Signals interruption or new generator state
+
+    /**
+     * @brief Produces the next batch of key bytes (called with mutex held).
+     * @param now Current time.
+     * @param bytes Receives the batch when it is due.
+     * @param wakeAt Receives when to ask again if nothing is due yet; left unchanged to wait for a notification.
+     * @return true if bytes were produced, false otherwise.
+     */
+    virtual bool generate(Clock::time_point now, std::string& bytes, Clock::time_point& wakeAt) = 0;
+
+    /**
+     * @brief Ends input after the bytes already produced (called with mutex held).
+     * @returns None
+     */
+    void finish();
+
+public:
+    /**
+     * @brief Constructs a source without a time limit.
+     * @returns None
+     */
+    SyntheticInputSource();
+
+    /**
+     * @brief Limits how long the source produces input.
+     *
+     * Afterwards input ends, which makes the game exit.
+     * @param seconds Duration in seconds, 0 for no limit.
+     * @returns None
+     */
+    void setDuration(int seconds);
+
+    bool waitForInput(int timeoutMs) override;
+    int readByte() override;
+    void interrupt() override;
+};
+
+#endif // INPUTSOURCE_H
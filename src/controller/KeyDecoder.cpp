@@ -0,0 +1,203 @@
+/**
+ * @file KeyDecoder.cpp
+ * @author Vld251
+ * @brief Implementation of the incremental key decoder.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "KeyDecoder.h"
+
+const int KeyDecoder::ESCAPE_TIMEOUT_MS;
+const int KeyDecoder::MAX_UTF8_BYTES;
+
+namespace {
+
+// Классы байтов: от класса и текущего состояния зависит действие
+enum ByteClass : unsigned char {
+    CONTROL,        // 0x00-0x1F, кроме ESC
+    ESC_BYTE,       // 0x1B
+    INTERMEDIATE,   // 0x20-0x2F: промежуточные байты CSI
+    PARAMETER,      // 0x30-0x3F: параметры CSI
+    BRACKET,        // '[' - начало CSI
+    LETTER_O,       // 'O' - начало SS3
+    FINAL,          // Остальные 0x40-0x7E: последний байт последовательности
+    DEL_BYTE,       // 0x7F
+    CONTINUATION,   // 0x80-0xBF: продолжение UTF-8
+    LEAD2,          // 0xC2-0xDF: начало двухбайтового символа
+    LEAD3,          // 0xE0-0xEF: начало трехбайтового символа
+    LEAD4,          // 0xF0-0xF4: начало четырехбайтового символа
+    INVALID,        // 0xC0, 0xC1, 0xF5-0xFF: в UTF-8 не встречаются
+    CLASS_COUNT
+};
+
+enum Action : unsigned char {
+    EMIT,           // Байт - готовый символ
+    START_ESCAPE,   // ESC: ждем продолжения или тайм-аута
+    START_CSI,      // ESC [
+    START_SS3,      // ESC O
+    COLLECT,        // Параметр последовательности - пропускаем (модификаторы не различаем)
+    FINISH,         // Последний байт последовательности
+    START_UTF8,     // Первый байт многобайтового символа
+    CONTINUE_UTF8,  // Байт продолжения символа
+    ESCAPE_REPLAY,  // Одиночный ESC, за которым сразу пришло другое: ESCAPE и разбор байта заново
+    ABORT_REPLAY,   // Оборванная последовательность: отбрасываем и разбираем байт заново
+    DROP            // Байт, который ничего не значит
+};
+
+struct ByteClassTable {
+    ByteClass classes[256];
+
+    ByteClassTable() {
+        for (int byte = 0; byte < 256; byte++) {
+            ByteClass byteClass;
+            if (byte == 0x1B) byteClass = ESC_BYTE;
+            else if (byte < 0x20) byteClass = CONTROL;
+            else if (byte < 0x30) byteClass = INTERMEDIATE;
+            else if (byte < 0x40) byteClass = PARAMETER;
+            else if (byte == '[') byteClass = BRACKET;
+            else if (byte == 'O') byteClass = LETTER_O;
+            else if (byte < 0x7F) byteClass = FINAL;
+            else if (byte == 0x7F) byteClass = DEL_BYTE;
+            else if (byte < 0xC0) byteClass = CONTINUATION;
+            else if (byte < 0xC2) byteClass = INVALID;
+            else if (byte < 0xE0) byteClass = LEAD2;
+            else if (byte < 0xF0) byteClass = LEAD3;
+            else if (byte < 0xF5) byteClass = LEAD4;
+            else byteClass = INVALID;
+            classes[byte] = byteClass;
+        }
+    }
+};
+
+const ByteClassTable BYTE_CLASSES;
+
+// Действие для каждого состояния (GROUND, ESCAPE, CSI, SS3, UTF8) и класса байта
+const Action TRANSITIONS[][CLASS_COUNT] = {
+    // CONTROL        ESC_BYTE       INTERMEDIATE   PARAMETER      BRACKET        LETTER_O       FINAL          DEL_BYTE       CONTINUATION   LEAD2          LEAD3          LEAD4          INVALID
+    { EMIT,          START_ESCAPE,  EMIT,          EMIT,          EMIT,          EMIT,          EMIT,          EMIT,          DROP,          START_UTF8,    START_UTF8,    START_UTF8,    DROP },
+    { ESCAPE_REPLAY, ESCAPE_REPLAY, ESCAPE_REPLAY, ESCAPE_REPLAY, START_CSI,     START_SS3,     ESCAPE_REPLAY, ESCAPE_REPLAY, ESCAPE_REPLAY, ESCAPE_REPLAY, ESCAPE_REPLAY, ESCAPE_REPLAY, ESCAPE_REPLAY },
+    { ABORT_REPLAY,  ABORT_REPLAY,  COLLECT,       COLLECT,       FINISH,        FINISH,        FINISH,        ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY },
+    { ABORT_REPLAY,  ABORT_REPLAY,  COLLECT,       COLLECT,       FINISH,        FINISH,        FINISH,        ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY },
+    { ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  CONTINUE_UTF8, ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY,  ABORT_REPLAY }
+};
+
+} // namespace
+
+KeyDecoder::KeyDecoder() : state(GROUND), codepoint(0), remaining(0), readyBegin(0), readyEnd(0) {
+    static_assert(sizeof(TRANSITIONS) / sizeof(TRANSITIONS[0]) == STATE_COUNT, "Transition table must cover every state");
+}
+
+void KeyDecoder::emit(KeyCode code, unsigned value) {
+    // Очередь опустошается до следующего байта, поэтому двух мест достаточно
+    if (readyBegin == readyEnd) {
+        readyBegin = 0;
+        readyEnd = 0;
+    }
+    if (readyEnd == 2) return;
+    ready[readyEnd].code = code;
+    ready[readyEnd].codepoint = value;
+    readyEnd++;
+}
+
+void KeyDecoder::finishSequence(unsigned char final) {
+    state = GROUND;
+    switch (final) {
+        case 'A': emit(KeyCode::UP, 0); break;
+        case 'B': emit(KeyCode::DOWN, 0); break;
+        case 'C': emit(KeyCode::RIGHT, 0); break;
+        case 'D': emit(KeyCode::LEFT, 0); break;
+        default: break; // Прочие клавиши (F1, Home, ...) не используются
+    }
+}
+
+void KeyDecoder::feed(unsigned char byte) {
+    ByteClass byteClass = BYTE_CLASSES.classes[byte];
+
+    switch (TRANSITIONS[state][byteClass]) {
+        case EMIT:
+            emit(KeyCode::CHARACTER, byte);
+            break;
+        case START_ESCAPE:
+            state = ESCAPE;
+            break;
+        case START_CSI:
+            state = CSI;
+            break;
+        case START_SS3:
+            state = SS3;
+            break;
+        case COLLECT:
+            break;
+        case FINISH:
+            finishSequence(byte);
+            break;
+        case START_UTF8:
+            // Длина символа и значащие биты первого байта определяются его классом
+            remaining = byteClass - LEAD2 + 1;
+            codepoint = byte & (0x3F >> remaining);
+            state = UTF8;
+            break;
+        case CONTINUE_UTF8:
+            codepoint = (codepoint << 6) | (byte & 0x3F);
+            if (--remaining == 0) {
+                state = GROUND;
+                emit(KeyCode::CHARACTER, codepoint);
+            }
+            break;
+        case ESCAPE_REPLAY:
+            emit(KeyCode::ESCAPE, 0);
+            state = GROUND;
+            feed(byte);
+            break;
+        case ABORT_REPLAY:
+            state = GROUND;
+            feed(byte);
+            break;
+        case DROP:
+            break;
+    }
+}
+
+void KeyDecoder::timeout() {
+    if (state == ESCAPE) {
+        emit(KeyCode::ESCAPE, 0);
+    }
+    state = GROUND;
+}
+
+bool KeyDecoder::isPending() const {
+    return state != GROUND;
+}
+
+bool KeyDecoder::next(Key& key) {
+    if (readyBegin == readyEnd) return false;
+    key = ready[readyBegin++];
+    return true;
+}
+
+int KeyDecoder::encodeUTF8(unsigned codepoint, char* out) {
+    if (codepoint < 0x80) {
+        out[0] = static_cast<char>(codepoint);
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+        out[1] = static_cast<char>(0x80 | (codepoint & 0x3F));
+        return 2;
+    }
+    if (codepoint < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+        out[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (codepoint & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+    out[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (codepoint & 0x3F));
+    return 4;
+}
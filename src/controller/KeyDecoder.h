@@ -0,0 +1,112 @@
+/**
+ * @file KeyDecoder.h
+ * @author Vld251
+ * @brief Incremental table-driven decoder of terminal escape sequences and UTF-8.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef KEYDECODER_H
+#define KEYDECODER_H
+
+/**
+ * @brief Kind of a decoded key.
+ */
+enum class KeyCode {
+    CHARACTER,  ///< Character key, see Key::codepoint
+    UP,         ///< Up arrow
+    DOWN,       ///< Down arrow
+    LEFT,       ///< Left arrow
+    RIGHT,      ///< Right arrow
+    ESCAPE      ///< Escape key pressed on its own
+};
+
+/**
+ * @brief Key decoded from terminal input.
+ */
+struct Key {
+    KeyCode code;           ///< Kind of key
+    unsigned codepoint;     ///< Unicode codepoint for CHARACTER keys, 0 otherwise
+};
+
+/**
+ * @brief Turns terminal input bytes into keys, one byte at a time.
+ * 
+ * A small state machine driven by a byte-class table: bytes of arrow key
+ * sequences (CSI "ESC [ A" and SS3 "ESC O A", with or without modifier
+ * parameters) and of multi-byte UTF-8 characters may arrive in separate
+ * reads. A lone ESC is told apart from the start of a sequence by time:
+ * if nothing follows within ESCAPE_TIMEOUT_MS, the caller reports a
+ * timeout and the decoder emits ESCAPE. Unknown sequences and malformed
+ * UTF-8 are dropped. Decoding never allocates.
+ */
+class KeyDecoder {
+public:
+    static const int ESCAPE_TIMEOUT_MS = 50;    ///< Wait for the rest of a sequence after ESC
+    static const int MAX_UTF8_BYTES = 4;        ///< Longest UTF-8 encoding of a codepoint
+
+private:
+    /**
+     * @brief Decoder state between bytes.
+     */
+    enum State { GROUND, ESCAPE, CSI, SS3, UTF8, STATE_COUNT };
+
+    State state;            ///< Current state
+    unsigned codepoint;     ///< Codepoint bits collected so far
+    int remaining;          ///< Continuation bytes still expected
+    Key ready[2];           ///< Decoded keys not taken yet (a byte can finish two keys)
+    int readyBegin;         ///< First untaken key in ready
+    int readyEnd;           ///< One past the last decoded key
+
+    void emit(KeyCode code, unsigned value);    ///< Queues a decoded key
+    void finishSequence(unsigned char final);   ///< Translates final byte of CSI/SS3 sequence
+
+public:
+    /**
+     * @brief Constructs a decoder waiting for the first byte of a key.
+     * @returns None
+     */
+    KeyDecoder();
+
+    /**
+     * @brief Processes one input byte.
+     * @param byte Byte read from the terminal.
+     * @returns None
+     */
+    void feed(unsigned char byte);
+
+    /**
+     * @brief Reports that no byte arrived within ESCAPE_TIMEOUT_MS.
+     *
+     * A pending ESC becomes an ESCAPE key; an incomplete sequence or
+     * character is dropped.
+     * @returns None
+     */
+    void timeout();
+
+    /**
+     * @brief Checks if the decoder is in the middle of a sequence or character.
+     * @return true if more bytes are expected, false otherwise.
+     */
+    bool isPending() const;
+
+    /**
+     * @brief Takes the next decoded key.
+     * @param key Receives the key.
+     * @return true if a key was available, false otherwise.
+     */
+    bool next(Key& key);
+
+    /**
+     * @brief Encodes a codepoint as UTF-8.
+     * @param codepoint Codepoint to encode.
+     * @param out Buffer for at least MAX_UTF8_BYTES bytes.
+     * @return Number of bytes written.
+     */
+    static int encodeUTF8(unsigned codepoint, char* out);
+};
+
+#endif // KEYDECODER_H
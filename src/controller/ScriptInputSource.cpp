@@ -0,0 +1,126 @@
+/**
+ * @file ScriptInputSource.cpp
+ * @author Vld251
+ * @brief Implementation of the key script player.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "ScriptInputSource.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+struct NamedKey {
+    const char* name;   // Имя клавиши в сценарии
+    const char* bytes;  // Что присылает терминал
+};
+
+const NamedKey NAMED_KEYS[] = {
+    { "enter",     "\n" },
+    { "esc",       "\033" },
+    { "space",     " " },
+    { "tab",       "\t" },
+    { "backspace", "\177" },
+    { "up",        "\033[A" },
+    { "down",      "\033[B" },
+    { "right",     "\033[C" },
+    { "left",      "\033[D" }
+};
+
+}
+
+ScriptInputSource::ScriptInputSource() : looped(false), nextStep(0) {}
+
+void ScriptInputSource::appendKey(const std::string& token, std::string& bytes) {
+    for (const NamedKey& key : NAMED_KEYS) {
+        if (token == key.name) {
+            bytes += key.bytes;
+            return;
+        }
+    }
+    bytes += token;
+}
+
+bool ScriptInputSource::loadFromFile(const std::string& path, int& errorLine) {
+    errorLine = 0;
+    std::ifstream file(path);
+    if (!file.is_open()) return false;
+
+    std::vector<Step> loaded;
+    bool loadedLoop = false;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        std::istringstream words(line);
+        std::string word;
+        if (!(words >> word) || word[0] == '#') continue;
+        if (word == "loop") {
+            loadedLoop = true;
+            continue;
+        }
+
+        // Первое слово - задержка в миллисекундах, дальше клавиши
+        char* end = nullptr;
+        long delay = std::strtol(word.c_str(), &end, 10);
+        Step step;
+        step.delayMs = static_cast<int>(delay);
+        if (*end != '\0' || delay < 0) {
+            errorLine = lineNumber;
+            return false;
+        }
+        while (words >> word) {
+            appendKey(word, step.bytes);
+        }
+        if (step.bytes.empty()) {
+            errorLine = lineNumber;
+            return false;
+        }
+        loaded.push_back(step);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    steps.swap(loaded);
+    looped = loadedLoop && !steps.empty();
+    nextStep = 0;
+    nextTime = Clock::time_point();
+    return true;
+}
+
+bool ScriptInputSource::generate(Clock::time_point now, std::string& bytes, Clock::time_point& wakeAt) {
+    if (nextStep >= steps.size()) {
+        if (!looped) {
+            finish();
+            return false;
+        }
+        nextStep = 0;
+    }
+
+    // Отсчёт задержек начинается с первого ожидания ввода, а не с загрузки сценария
+    if (nextTime == Clock::time_point()) {
+        nextTime = now + std::chrono::milliseconds(steps[nextStep].delayMs);
+    }
+    if (now < nextTime) {
+        wakeAt = nextTime;
+        return false;
+    }
+
+    bytes = steps[nextStep].bytes;
+    nextStep++;
+    if (nextStep < steps.size() || looped) {
+        const Step& following = steps[nextStep < steps.size() ? nextStep : 0];
+        // Задержка отсчитывается от фактической отправки: после долгой паузы шаги не идут пачкой
+        nextTime = now + std::chrono::milliseconds(following.delayMs);
+    }
+    return true;
+}
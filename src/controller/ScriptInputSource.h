@@ -0,0 +1,66 @@
+/**
+ * @file ScriptInputSource.h
+ * @author Vld251
+ * @brief Key source replaying a timed key script.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef SCRIPTINPUTSOURCE_H
+#define SCRIPTINPUTSOURCE_H
+
+#include "InputSource.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Sends keys from a script file at scripted moments.
+ * 
+ * Script format: one "<delay ms> <key> [<key> ...]" line per step, the
+ * delay counted from the previous step; all keys of a step are sent in one
+ * batch. A key is a name (enter, esc, space, tab, backspace, up, down,
+ * left, right) or literal UTF-8 text. A "loop" line restarts the script
+ * after its last step, otherwise input ends there and the game exits.
+ * Lines starting with '#' are comments.
+ */
+class ScriptInputSource : public SyntheticInputSource {
+private:
+    /**
+     * @brief One scripted batch of keys.
+     */
+    struct Step {
+        int delayMs;        ///< Delay after the previous step
+        std::string bytes;  ///< Bytes sent by the step
+    };
+
+    std::vector<Step> steps;        ///< Parsed script
+    bool looped;                    ///< Script restarts after the last step
+    size_t nextStep;                ///< Step to send next
+    Clock::time_point nextTime;     ///< When the next step is due, epoch before the first wait
+
+    static void appendKey(const std::string& token, std::string& bytes); ///< Appends bytes of a key token
+
+protected:
+    bool generate(Clock::time_point now, std::string& bytes, Clock::time_point& wakeAt) override;
+
+public:
+    /**
+     * @brief Constructs an empty script.
+     * @returns None
+     */
+    ScriptInputSource();
+
+    /**
+     * @brief Loads script from file.
+     * @param path Path to script file.
+     * @param errorLine Receives number of the first malformed line, 0 if the file could not be opened.
+     * @return true if the whole script was read, false otherwise.
+     */
+    bool loadFromFile(const std::string& path, int& errorLine);
+};
+
+#endif // SCRIPTINPUTSOURCE_H
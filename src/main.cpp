@@ -11,7 +11,59 @@
 
 #include <iostream>
 #include "controller/GameController.h"
+#include "controller/ScriptInputSource.h"
+#include "controller/BotInputSource.h"
 #include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Command line options selecting the source of keys.
+ */
+struct InputOptions {
+    std::string scriptPath;     ///< Key script to replay, empty for none
+    bool bot;                   ///< Let the bot play
+    int botInterval;            ///< Minimum pause between bot keys in milliseconds
+    int duration;               ///< Seconds of generated input before exiting, 0 for no limit
+    unsigned int seed;          ///< Seed of the bot's choices
+};
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program
+              << " [--script FILE | --bot [--bot-interval MS] [--seed N]] [--duration SECONDS]\n\n"
+              << "  --script FILE      replay keys from a script instead of the keyboard\n"
+              << "  --bot              let a bot play instead of the keyboard\n"
+              << "  --bot-interval MS  minimum pause between bot keys (default 30)\n"
+              << "  --seed N           seed of the bot's random moves\n"
+              << "  --duration SECONDS end scripted or bot input and exit after this time\n";
+}
+
+bool parseOptions(int argc, char* argv[], InputOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--script" && hasValue) {
+            options.scriptPath = argv[++i];
+        } else if (arg == "--bot") {
+            options.bot = true;
+        } else if (arg == "--bot-interval" && hasValue) {
+            options.botInterval = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--duration" && hasValue) {
+            options.duration = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+    return !(options.bot && !options.scriptPath.empty());
+}
+
+} // namespace
 
 /**
  * @brief Main entry point for the Tank Simulator game.
@@ -27,16 +79,29 @@
  * @brief Main function that serves as the application entry point.
  * 
  * This function performs the following tasks:
- * 1. Checks terminal size requirements
- * 2. Initializes game dimensions based on terminal size
- * 3. Creates and runs the GameController
- * 4. Handles exceptions and error conditions
+ * 1. Parses command line options (scripted or bot input)
+ * 2. Checks terminal size requirements
+ * 3. Chooses field dimensions of generated levels
+ * 4. Creates and runs the GameController
+ * 5. Handles exceptions and error conditions
  * 
+ * @param argc Number of command line arguments.
+ * @param argv Command line arguments.
  * @return int - Exit status code:
  *               - 0: Successful execution
  *               - -1: Error during execution
  */
-int main() {
+int main(int argc, char* argv[]) {
+    InputOptions options;
+    options.bot = false;
+    options.botInterval = 30;
+    options.duration = 0;
+    options.seed = static_cast<unsigned int>(time(nullptr));
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return -1;
+    }
+
     try {
         // Minimum terminal dimensions required for proper game display
         const int MIN_WIDTH = 60;    ///< Minimum terminal width in characters
@@ -49,18 +114,31 @@ int main() {
             return -1;
         }
 
-        // Get current terminal dimensions
-        auto terminalSize = PlatformUtils::getTerminalSize();
-        int termWidth = terminalSize.first;
-        int termHeight = terminalSize.second;
-
-        // Calculate game dimensions based on terminal size
-        // Use minimum of required and available dimensions
-        int gameWidth = std::min(MIN_WIDTH, termWidth);
-        int gameHeight = std::min(MIN_HEIGHT, termHeight);
+        // Field size of randomly generated levels; maps define their own size,
+        // and fields larger than the terminal are shown through a scrolling camera
+        const int FIELD_WIDTH = 40;    ///< Generated field width in cells
+        const int FIELD_HEIGHT = 20;   ///< Generated field height in cells
         
         // Create and initialize the main game controller
-        GameController game(gameWidth, gameHeight);
+        GameController game(FIELD_WIDTH, FIELD_HEIGHT);
+
+        // Вместо клавиатуры - сценарий или бот: для долгих прогонов без человека
+        if (!options.scriptPath.empty()) {
+            std::unique_ptr<ScriptInputSource> script(new ScriptInputSource());
+            int errorLine = 0;
+            if (!script->loadFromFile(options.scriptPath, errorLine)) {
+                std::cerr << "Cannot read key script " << options.scriptPath;
+                if (errorLine > 0) std::cerr << ", line " << errorLine;
+                std::cerr << std::endl;
+                return -1;
+            }
+            script->setDuration(options.duration);
+            game.setInputSource(std::move(script));
+        } else if (options.bot) {
+            std::unique_ptr<BotInputSource> bot(new BotInputSource(options.seed, options.botInterval));
+            bot->setDuration(options.duration);
+            game.setInputSource(std::move(bot));
+        }
         
         // Start the main game loop
         game.runGame();
@@ -0,0 +1,46 @@
+/**
+ * @file AIParams.h
+ * @author Vld251
+ * @brief Tunable constants of the enemy AI.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef AIPARAMS_H
+#define AIPARAMS_H
+
+/**
+ * @brief Parameters controlling enemy decisions.
+ * 
+ * Defaults reproduce the hand-picked values of the original AI. The world
+ * owns one instance and hands it to every enemy, so the self-play tuner
+ * can sweep them without rebuilding the game.
+ */
+struct AIParams {
+    int wanderMoveChance;       ///< Percent chance to keep moving forward when wandering
+    int approachChance;         ///< Percent chance to head for the player when approaching
+    int cautiousMoveChance;     ///< Percent chance to step forward during cautious approach
+    int coverSidestepChance;    ///< Percent chance to sidestep when no safe cell is known
+    int shotChanceBonus;        ///< Added to archetype shot chance (percent)
+    int retreatDistance;        ///< Aggressive tank backs off at this distance or closer
+    int engageDistance;         ///< Aggressive tank holds position within this distance
+    int defensiveRetreatDistance; ///< Defensive tank backs off at this distance or closer
+    int defensiveHoldDistance;  ///< Defensive tank holds position within this distance
+    int cautiousDistance;       ///< Beyond this distance cautious approach speeds up
+
+    /**
+     * @brief Constructs parameters with default values.
+     * @returns None
+     */
+    AIParams()
+        : wanderMoveChance(70), approachChance(80), cautiousMoveChance(33),
+          coverSidestepChance(50), shotChanceBonus(0),
+          retreatDistance(3), engageDistance(6),
+          defensiveRetreatDistance(2), defensiveHoldDistance(5),
+          cautiousDistance(8) {}
+};
+
+#endif // AIPARAMS_H
@@ -0,0 +1,113 @@
+/**
+ * @file BinaryStream.cpp
+ * @author Vld251
+ * @brief Implementation of the little-endian byte buffers.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "BinaryStream.h"
+#include <cstring>
+
+BinaryWriter::BinaryWriter(std::vector<char>& out) : buffer(out) {}
+
+void BinaryWriter::writeInt(int value) {
+    unsigned int bits = static_cast<unsigned int>(value);
+    char bytes[4];
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = static_cast<char>((bits >> (8 * i)) & 0xFF);
+    }
+    buffer.insert(buffer.end(), bytes, bytes + 4);
+}
+
+void BinaryWriter::writeBool(bool value) {
+    buffer.push_back(value ? 1 : 0);
+}
+
+void BinaryWriter::writeString(const std::string& value) {
+    writeInt(static_cast<int>(value.size()));
+    writeBytes(value.data(), value.size());
+}
+
+void BinaryWriter::writeBytes(const char* bytes, size_t length) {
+    buffer.insert(buffer.end(), bytes, bytes + length);
+}
+
+BinaryReader::BinaryReader(const char* bytes, size_t length)
+    : data(bytes), size(length), offset(0), failed(false) {}
+
+int BinaryReader::readInt() {
+    if (failed || size - offset < 4) {
+        failed = true;
+        return 0;
+    }
+
+    unsigned int bits = 0;
+    for (int i = 0; i < 4; i++) {
+        bits |= static_cast<unsigned int>(static_cast<unsigned char>(data[offset + i])) << (8 * i);
+    }
+    offset += 4;
+
+    // Обратно в знаковое без зависимости от реализации преобразования
+    int value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+int BinaryReader::readInt(int min, int max) {
+    int value = readInt();
+    if (value < min || value > max) {
+        failed = true;
+        return min;
+    }
+    return value;
+}
+
+bool BinaryReader::readBool() {
+    if (failed || offset >= size) {
+        failed = true;
+        return false;
+    }
+
+    char value = data[offset++];
+    if (value != 0 && value != 1) {
+        failed = true;
+    }
+    return value == 1;
+}
+
+std::string BinaryReader::readString() {
+    int length = readInt();
+    if (failed || length < 0 || static_cast<size_t>(length) > size - offset) {
+        failed = true;
+        return std::string();
+    }
+
+    std::string value(data + offset, static_cast<size_t>(length));
+    offset += static_cast<size_t>(length);
+    return value;
+}
+
+bool BinaryReader::expectBytes(const char* expected, size_t length) {
+    if (failed || size - offset < length || std::memcmp(data + offset, expected, length) != 0) {
+        failed = true;
+        return false;
+    }
+    offset += length;
+    return true;
+}
+
+void BinaryReader::fail() {
+    failed = true;
+}
+
+bool BinaryReader::ok() const {
+    return !failed;
+}
+
+bool BinaryReader::atEnd() const {
+    return offset == size;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file BinaryStream.h
+ * @author Vld251
+ * @brief Little-endian byte buffers for saving and restoring game state.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef BINARYSTREAM_H
+#define BINARYSTREAM_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Appends values to a byte buffer in a fixed, platform-independent layout.
+ * 
+ * Integers are stored as 4 bytes, least significant first, so saves made
+ * on one platform load on another.
+ */
+class BinaryWriter {
+private:
+    std::vector<char>& buffer;  ///< Output buffer (not owned)
+
+public:
+    /**
+     * @brief Constructs a writer appending to a buffer.
+     * @param out Buffer to append to.
+     * @returns None
+     */
+    explicit BinaryWriter(std::vector<char>& out);
+
+    /**
+     * @brief Appends a 32-bit integer.
+     * @param value Value to write.
+     * @returns None
+     */
+    void writeInt(int value);
+
+    /**
+     * @brief Appends a boolean as one byte.
+     * @param value Value to write.
+     * @returns None
+     */
+    void writeBool(bool value);
+
+    /**
+     * @brief Appends a string prefixed with its length.
+     * @param value Value to write.
+     * @returns None
+     */
+    void writeString(const std::string& value);
+
+    /**
+     * @brief Appends raw bytes.
+     * @param data Bytes to write.
+     * @param size Number of bytes.
+     * @returns None
+     */
+    void writeBytes(const char* data, size_t size);
+};
+
+/**
+ * @brief Reads values written by BinaryWriter, checking bounds.
+ * 
+ * Reading past the end or an out-of-range value marks the reader failed;
+ * further reads return zeros, so callers check ok() once at the end.
+ */
+class BinaryReader {
+private:
+    const char* data;   ///< Input bytes (not owned)
+    size_t size;        ///< Number of input bytes
+    size_t offset;      ///< Next byte to read
+    bool failed;        ///< A read went past the end or was out of range
+
+public:
+    /**
+     * @brief Constructs a reader over a byte range.
+     * @param bytes Input bytes.
+     * @param length Number of input bytes.
+     * @returns None
+     */
+    BinaryReader(const char* bytes, size_t length);
+
+    /**
+     * @brief Reads a 32-bit integer.
+     * @return Value, 0 on failure.
+     */
+    int readInt();
+
+    /**
+     * @brief Reads a 32-bit integer that must lie in a range.
+     * @param min Smallest valid value.
+     * @param max Largest valid value.
+     * @return Value, min on failure.
+     */
+    int readInt(int min, int max);
+
+    /**
+     * @brief Reads a boolean.
+     * @return Value, false on failure.
+     */
+    bool readBool();
+
+    /**
+     * @brief Reads a length-prefixed string.
+     * @return Value, empty on failure.
+     */
+    std::string readString();
+
+    /**
+     * @brief Checks and skips bytes that must match exactly.
+     * @param expected Expected bytes.
+     * @param length Number of bytes.
+     * @return true if the bytes matched.
+     */
+    bool expectBytes(const char* expected, size_t length);
+
+    /**
+     * @brief Marks the reader failed, for values invalid in context.
+     * @returns None
+     */
+    void fail();
+
+    /**
+     * @brief Checks that all reads so far succeeded.
+     * @return true if no read failed.
+     */
+    bool ok() const;
+
+    /**
+     * @brief Checks that the whole input was read.
+     * @return true if no bytes are left.
+     */
+    bool atEnd() const;
+};
+
+#endif // BINARYSTREAM_H
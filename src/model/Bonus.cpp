@@ -11,6 +11,7 @@
 
 #include "Bonus.h"
 #include "PlayerTank.h"
+#include "BinaryStream.h"
 
 Bonus::Bonus(Point pos, BonusType bonusType, int dur)
     : GameObject(pos, Direction::UP, 0, 1, true), 
@@ -75,3 +76,19 @@ char Bonus::getSymbol() const {
         default: return '?';
     }
 }
+
+void Bonus::save(BinaryWriter& out) const {
+    GameObject::save(out);
+    out.writeInt(static_cast<int>(type));
+    out.writeInt(duration);
+    out.writeBool(active);
+    out.writeInt(activationTime);
+}
+
+void Bonus::load(BinaryReader& in) {
+    GameObject::load(in);
+    type = static_cast<BonusType>(in.readInt(0, 3));
+    duration = in.readInt();
+    active = in.readBool();
+    activationTime = in.readInt();
+}
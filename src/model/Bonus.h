@@ -99,6 +99,9 @@ public:
      * @return The symbol representing the bonus type.
      */
     char getSymbol() const override;
+
+    void save(BinaryWriter& out) const override;
+    void load(BinaryReader& in) override;
 };
 
 #endif // BONUS_H
@@ -0,0 +1,200 @@
+/**
+ * @file DangerMap.cpp
+ * @author Vld251
+ * @brief Implementation of the incremental danger map used by defensive AI.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "DangerMap.h"
+#include <cstdlib>
+
+DangerMap::DangerMap()
+    : width(0), height(0), lineOrigin(Point(-1, -1)),
+      lineDirection(Direction::UP), linesValid(false) {}
+
+void DangerMap::reset(const TerrainGrid& terrain) {
+    width = terrain.getWidth();
+    height = terrain.getHeight();
+
+    size_t size = static_cast<size_t>(width) * height;
+    flags.assign(size, 0);
+    lineWeight.assign(size, 0);
+    blastCount.assign(size, 0);
+    for (auto& ray : rays) {
+        ray.clear();
+    }
+    blasts.clear();
+    linesValid = false;
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            updateCell(Point(x, y), terrain);
+        }
+    }
+}
+
+void DangerMap::updateCell(const Point& pos, const TerrainGrid& terrain) {
+    int idx = index(pos);
+    if (idx < 0) return;
+
+    unsigned char cellFlags = 0;
+    if (terrain.blocksTanks(pos)) cellFlags |= BLOCKS_TANK;
+    if (terrain.blocksProjectiles(pos)) cellFlags |= BLOCKS_PROJECTILE;
+
+    if (flags[idx] != cellFlags) {
+        flags[idx] = cellFlags;
+        // Разрушенная стена могла открыть линию огня - перестроим лучи при следующем ходе
+        linesValid = false;
+    }
+}
+
+void DangerMap::trackPlayer(const Point& pos, Direction dir) {
+    if (!linesValid || pos != lineOrigin) {
+        // Игрок сдвинулся - перестраиваем лучи
+        clearLines();
+        buildRays(pos);
+        addRayWeight(dir, 1);
+        lineOrigin = pos;
+        lineDirection = dir;
+        linesValid = true;
+        return;
+    }
+
+    if (dir != lineDirection) {
+        // Игрок только повернулся - переносим вес на новый луч
+        addRayWeight(lineDirection, -1);
+        addRayWeight(dir, 1);
+        lineDirection = dir;
+    }
+}
+
+void DangerMap::addBlast(const Point& center, int ttl) {
+    Blast blast;
+    blast.center = center;
+    blast.ttl = ttl;
+    blasts.push_back(blast);
+    stampBlast(center, 1);
+}
+
+const std::vector<DangerMap::Blast>& DangerMap::getBlasts() const {
+    return blasts;
+}
+
+void DangerMap::tick() {
+    for (size_t i = 0; i < blasts.size();) {
+        blasts[i].ttl--;
+        if (blasts[i].ttl <= 0) {
+            stampBlast(blasts[i].center, -1);
+            blasts[i] = blasts.back();
+            blasts.pop_back();
+        } else {
+            i++;
+        }
+    }
+}
+
+int DangerMap::getDanger(const Point& pos) const {
+    int idx = index(pos);
+    if (idx < 0) return 0;
+    return lineWeight[idx] + (blastCount[idx] > 0 ? 2 : 0);
+}
+
+bool DangerMap::isOnFireLine(const Point& pos) const {
+    int idx = index(pos);
+    return idx >= 0 && lineWeight[idx] > 0;
+}
+
+bool DangerMap::isPassable(const Point& pos) const {
+    int idx = index(pos);
+    return idx >= 0 && (flags[idx] & BLOCKS_TANK) == 0;
+}
+
+bool DangerMap::findSafeDirection(const Point& from, Direction toThreat, Direction& result) const {
+    // Сначала перпендикулярные направления, затем отступление
+    Direction candidates[3];
+    if (toThreat == Direction::UP || toThreat == Direction::DOWN) {
+        candidates[0] = Direction::LEFT;
+        candidates[1] = Direction::RIGHT;
+        candidates[2] = (toThreat == Direction::UP) ? Direction::DOWN : Direction::UP;
+    } else {
+        candidates[0] = Direction::UP;
+        candidates[1] = Direction::DOWN;
+        candidates[2] = (toThreat == Direction::LEFT) ? Direction::RIGHT : Direction::LEFT;
+    }
+
+    int bestDanger = -1;
+    for (Direction dir : candidates) {
+        Point next = from;
+        switch (dir) {
+            case Direction::UP: next.y -= 1; break;
+            case Direction::DOWN: next.y += 1; break;
+            case Direction::LEFT: next.x -= 1; break;
+            case Direction::RIGHT: next.x += 1; break;
+        }
+
+        if (!isPassable(next)) continue;
+
+        int danger = getDanger(next);
+        if (bestDanger < 0 || danger < bestDanger) {
+            bestDanger = danger;
+            result = dir;
+        }
+    }
+
+    return bestDanger >= 0;
+}
+
+void DangerMap::clearLines() {
+    for (auto& ray : rays) {
+        for (int idx : ray) {
+            lineWeight[idx] = 0;
+        }
+        ray.clear();
+    }
+}
+
+void DangerMap::buildRays(const Point& origin) {
+    static const int dx[4] = {0, 0, -1, 1};  // UP, DOWN, LEFT, RIGHT
+    static const int dy[4] = {-1, 1, 0, 0};
+
+    for (int d = 0; d < 4; d++) {
+        Point cell = origin;
+        for (int step = 0; step < FIRE_RANGE; step++) {
+            cell.x += dx[d];
+            cell.y += dy[d];
+
+            int idx = index(cell);
+            if (idx < 0 || (flags[idx] & BLOCKS_PROJECTILE)) break;
+
+            lineWeight[idx] += 1;
+            rays[d].push_back(idx);
+        }
+    }
+}
+
+void DangerMap::addRayWeight(Direction dir, int delta) {
+    for (int idx : rays[static_cast<int>(dir)]) {
+        lineWeight[idx] = static_cast<unsigned char>(lineWeight[idx] + delta);
+    }
+}
+
+void DangerMap::stampBlast(const Point& center, int delta) {
+    for (int dy = -BLAST_RADIUS; dy <= BLAST_RADIUS; dy++) {
+        for (int dx = -BLAST_RADIUS; dx <= BLAST_RADIUS; dx++) {
+            if (abs(dx) + abs(dy) > BLAST_RADIUS) continue;
+
+            int idx = index(Point(center.x + dx, center.y + dy));
+            if (idx < 0) continue;
+            blastCount[idx] = static_cast<unsigned char>(blastCount[idx] + delta);
+        }
+    }
+}
+
+int DangerMap::index(const Point& pos) const {
+    if (pos.x < 0 || pos.x >= width || pos.y < 0 || pos.y >= height) return -1;
+    return pos.y * width + pos.x;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file DangerMap.h
+ * @author Vld251
+ * @brief Incrementally maintained influence map of player firing lines and recent explosions.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef DANGERMAP_H
+#define DANGERMAP_H
+
+#include "GameObject.h"
+#include "TerrainGrid.h"
+#include <vector>
+
+/**
+ * @brief World-level map of cells threatened by the player.
+ * 
+ * Marks the four rays the player can fire along (the facing ray weighs
+ * more) until they hit a wall, plus cells around recent explosions.
+ * Rays are re-walked only when the player moves; a turn just moves the
+ * extra weight between two rays. Enemies read danger per cell in O(1).
+ */
+class DangerMap {
+public:
+    /**
+     * @brief Area around an explosion that stays dangerous for a few ticks.
+     */
+    struct Blast {
+        Point center;   ///< Explosion position
+        int ttl;        ///< Remaining ticks
+    };
+
+private:
+    int width;                              ///< Map width in cells
+    int height;                             ///< Map height in cells
+    std::vector<unsigned char> flags;       ///< Terrain flags per cell
+    std::vector<unsigned char> lineWeight;  ///< Firing line danger per cell
+    std::vector<unsigned char> blastCount;  ///< Number of blasts covering each cell
+    std::vector<int> rays[4];               ///< Cells of each firing ray (indexed by Direction)
+    std::vector<Blast> blasts;              ///< Active explosion areas
+
+    Point lineOrigin;                       ///< Player position the rays were built for
+    Direction lineDirection;                ///< Player direction the weights were built for
+    bool linesValid;                        ///< Whether rays match current terrain
+
+    static const unsigned char BLOCKS_TANK = 1;        ///< Cell flag: impassable for tanks
+    static const unsigned char BLOCKS_PROJECTILE = 2;  ///< Cell flag: stops projectiles
+
+    void clearLines();                                 ///< Removes all ray marks
+    void buildRays(const Point& origin);               ///< Walks and marks all four rays
+    void addRayWeight(Direction dir, int delta);       ///< Adds weight to every cell of a ray
+    void stampBlast(const Point& center, int delta);   ///< Marks or unmarks blast area
+    int index(const Point& pos) const;                 ///< Cell index or -1 if outside
+
+public:
+    static const int FIRE_RANGE = 20;       ///< Ray length, matches projectile range
+    static const int BLAST_RADIUS = 1;      ///< Radius of dangerous area around explosion
+    static const int BLAST_LIFETIME = 3;    ///< Ticks an explosion area stays dangerous
+
+    /**
+     * @brief Constructs an empty danger map.
+     * @returns None
+     */
+    DangerMap();
+
+    /**
+     * @brief Rebuilds map for new terrain, dropping all marks.
+     * @param terrain Terrain of the level.
+     * @returns None
+     */
+    void reset(const TerrainGrid& terrain);
+
+    /**
+     * @brief Updates one cell after terrain change (e.g. destroyed wall).
+     * @param pos Changed cell.
+     * @param terrain Current terrain.
+     * @returns None
+     */
+    void updateCell(const Point& pos, const TerrainGrid& terrain);
+
+    /**
+     * @brief Follows player position and direction, updating rays incrementally.
+     * @param pos Player position.
+     * @param dir Player direction.
+     * @returns None
+     */
+    void trackPlayer(const Point& pos, Direction dir);
+
+    /**
+     * @brief Registers an explosion.
+     * @param center Explosion position.
+     * @param ttl Ticks the area stays dangerous (less when restoring a saved game).
+     * @returns None
+     */
+    void addBlast(const Point& center, int ttl = BLAST_LIFETIME);
+
+    /**
+     * @brief Gets explosion areas that are still dangerous.
+     * @return Active blasts.
+     */
+    const std::vector<Blast>& getBlasts() const;
+
+    /**
+     * @brief Ages explosion areas by one tick.
+     * @returns None
+     */
+    void tick();
+
+    /**
+     * @brief Gets danger level of cell.
+     * @param pos Cell position.
+     * @return 0 if safe, higher values for more dangerous cells.
+     */
+    int getDanger(const Point& pos) const;
+
+    /**
+     * @brief Checks if cell is on one of the player's firing lines.
+     * @param pos Cell position.
+     * @return true if on a firing line, false otherwise.
+     */
+    bool isOnFireLine(const Point& pos) const;
+
+    /**
+     * @brief Checks if tank can stand on cell.
+     * @param pos Cell position.
+     * @return true if passable, false otherwise.
+     */
+    bool isPassable(const Point& pos) const;
+
+    /**
+     * @brief Picks the least dangerous passable neighbour to step into.
+     * @param from Current position.
+     * @param toThreat Direction towards the threat (never chosen).
+     * @param result Chosen direction.
+     * @return true if a direction was found, false if all neighbours are blocked.
+     */
+    bool findSafeDirection(const Point& from, Direction toThreat, Direction& result) const;
+};
+
+#endif // DANGERMAP_H
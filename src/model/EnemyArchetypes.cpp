@@ -0,0 +1,55 @@
+/**
+ * @file EnemyArchetypes.cpp
+ * @author Vld251
+ * @brief Enemy archetype table and AI constant lookups.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "EnemyArchetypes.h"
+
+namespace {
+
+// Порядок строк совпадает с порядком EnemyTankType
+const EnemyArchetype ARCHETYPES[EnemyArchetypes::TYPE_COUNT] = {
+    //  sym  spd  hp  dmg  score  spawn % (ур. 1, 2-3, 4+)
+    {   'E',  1,   2,  1,   100,  {100, 50, 30} },   // BASIC
+    {   'F',  2,   1,  1,   150,  {  0, 20, 25} },   // FAST
+    {   'D',  1,   1,  2,   200,  {  0, 15, 20} },   // DAMAGE
+    {   'A',  1,   4,  1,   250,  {  0, 15, 25} }    // ARMORED
+};
+
+// Базовый шанс выстрела по AIBehavior (RANDOM, AGGRESSIVE, DEFENSIVE)
+const int SHOT_CHANCE_BASE[] = { 30, 70, 40 };
+const int SHOT_CHANCE_PER_DIFFICULTY = 10;
+
+}
+
+const EnemyArchetype& EnemyArchetypes::get(EnemyTankType type) {
+    return ARCHETYPES[static_cast<int>(type)];
+}
+
+int EnemyArchetypes::getSpawnTier(int level) {
+    return (level >= 2) + (level >= 4);
+}
+
+EnemyTankType EnemyArchetypes::rollType(int level, int roll) {
+    int tier = getSpawnTier(level);
+    int threshold = 0;
+
+    for (int i = 0; i < TYPE_COUNT; i++) {
+        threshold += ARCHETYPES[i].spawnWeight[tier];
+        if (roll < threshold) {
+            return static_cast<EnemyTankType>(i);
+        }
+    }
+
+    return EnemyTankType::BASIC;
+}
+
+int EnemyArchetypes::getShotChance(AIBehavior behavior, int difficulty) {
+    return SHOT_CHANCE_BASE[static_cast<int>(behavior)] + difficulty * SHOT_CHANCE_PER_DIFFICULTY;
+}
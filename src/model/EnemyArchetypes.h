@@ -0,0 +1,72 @@
+/**
+ * @file EnemyArchetypes.h
+ * @author Vld251
+ * @brief Data table describing every enemy tank type in one place.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef ENEMYARCHETYPES_H
+#define ENEMYARCHETYPES_H
+
+#include "EnemyTank.h"
+
+/**
+ * @brief Static characteristics of one enemy tank type.
+ */
+struct EnemyArchetype {
+    char symbol;            ///< Map/display symbol
+    int speed;              ///< Base movement speed
+    int health;             ///< Initial health points
+    int damage;             ///< Damage dealt by its projectiles
+    int score;              ///< Points awarded to the player for destroying it
+    int spawnWeight[3];     ///< Spawn chance in percent per level tier (1, 2-3, 4+)
+};
+
+/**
+ * @brief Lookup tables for enemy archetypes and AI constants.
+ * 
+ * All per-type numbers live in a single table indexed by EnemyTankType,
+ * so adding a tank type means adding a row, not new switch branches.
+ */
+class EnemyArchetypes {
+public:
+    static const int TYPE_COUNT = 4;          ///< Number of enemy tank types
+    static const int TIER_COUNT = 3;          ///< Number of spawn tiers
+    static const int SPAWN_ROLL_RANGE = 100;  ///< Spawn rolls are taken from [0, SPAWN_ROLL_RANGE)
+
+    /**
+     * @brief Gets archetype of tank type.
+     * @param type Enemy tank type.
+     * @return Const reference to archetype row.
+     */
+    static const EnemyArchetype& get(EnemyTankType type);
+
+    /**
+     * @brief Gets spawn tier of a level.
+     * @param level Game level.
+     * @return Tier index (0 - first level, 1 - levels 2-3, 2 - level 4 and above).
+     */
+    static int getSpawnTier(int level);
+
+    /**
+     * @brief Picks tank type for a spawn roll using weights of the level tier.
+     * @param level Game level.
+     * @param roll Random value in [0, SPAWN_ROLL_RANGE).
+     * @return Enemy tank type.
+     */
+    static EnemyTankType rollType(int level, int roll);
+
+    /**
+     * @brief Gets chance in percent that an enemy shoots when it has a clear shot.
+     * @param behavior AI behavior of the enemy.
+     * @param difficulty AI difficulty level.
+     * @return Shot chance in percent.
+     */
+    static int getShotChance(AIBehavior behavior, int difficulty);
+};
+
+#endif // ENEMYARCHETYPES_H
@@ -10,44 +10,122 @@
  */
 
 #include "EnemyTank.h"
+#include "EnemyArchetypes.h"
+#include "BinaryStream.h"
 #include <cstdlib>
+#include <climits>
 #include <algorithm>
 
+namespace {
+
+Point stepFrom(const Point& pos, Direction dir) {
+    Point next = pos;
+    switch (dir) {
+        case Direction::UP: next.y -= 1; break;
+        case Direction::DOWN: next.y += 1; break;
+        case Direction::LEFT: next.x -= 1; break;
+        case Direction::RIGHT: next.x += 1; break;
+    }
+    return next;
+}
+
+}
+
 EnemyTank::EnemyTank(Point pos, AIBehavior behav, int diff, EnemyTankType type)
     : Tank(pos, Direction::DOWN, 1, 2, 1), 
       behavior(behav), difficulty(diff), tankType(type),
       playerLastPosition(Point(-1, -1)),
-      moveCooldown(0)
+      moveCooldown(0),
+      cachedDistance(-1), cachedDirection(Direction::DOWN),
+      cachedAligned(false), targetingValid(false),
+      targetingOrigin(Point(-1, -1)),
+      dangerMap(nullptr), aiParams(nullptr), rng(nullptr),
+      navigation(nullptr), terrain(nullptr),
+      pathHint(Direction::DOWN), pathFound(false),
+      pathOrigin(Point(-1, -1)), pathTarget(Point(-1, -1)), pathRevision(0),
+      routeCluster(-1), routeRevision(0)
 {
     setReloadTime(2);
     
-    // Настраиваем характеристики в зависимости от типа танка
-    switch(tankType) {
-        case EnemyTankType::FAST:
-            setSpeed(2);  // Увеличиваем скорость
-            setHealth(1); // Низкое здоровье
-            break;
-            
-        case EnemyTankType::DAMAGE:
-            setSpeed(1);
-            setHealth(1);
-            break;
-            
-        case EnemyTankType::ARMORED:
-            setSpeed(1);
-            setHealth(4);  // Удвоенное здоровье
-            break;
-            
-        case EnemyTankType::BASIC:
-        default:
-            setSpeed(1);
-            setHealth(2);
-            break;
-    }
+    // Характеристики берем из таблицы архетипов
+    const EnemyArchetype& archetype = EnemyArchetypes::get(tankType);
+    setSpeed(archetype.speed);
+    setHealth(archetype.health);
 }
 
 void EnemyTank::setPlayerPosition(Point playerPos) { 
     playerLastPosition = playerPos; 
+    targetingValid = false;
+}
+
+void EnemyTank::setTargeting(int distance, Direction dir, bool aligned) {
+    cachedDistance = distance;
+    cachedDirection = dir;
+    cachedAligned = aligned;
+    targetingOrigin = position;
+    targetingValid = true;
+}
+
+void EnemyTank::setDangerMap(const DangerMap* map) {
+    dangerMap = map;
+}
+
+void EnemyTank::setAIContext(const AIParams* params, std::mt19937* generator) {
+    aiParams = params;
+    rng = generator;
+}
+
+const AIParams& EnemyTank::params() const {
+    static const AIParams defaults;
+    return aiParams ? *aiParams : defaults;
+}
+
+int EnemyTank::roll(int range) const {
+    // Без генератора мира используем общий rand()
+    if (!rng) return rand() % range;
+    return std::uniform_int_distribution<>(0, range - 1)(*rng);
+}
+
+void EnemyTank::setNavigation(const NavGraph* graph, const TerrainGrid* grid) {
+    navigation = graph;
+    terrain = grid;
+}
+
+bool EnemyTank::findPath() {
+    if (!navigation || !terrain || playerLastPosition.x == -1) return false;
+
+    // Шаг пересчитывается, если сдвинулся враг или игрок либо изменился граф
+    unsigned int revision = navigation->getRevision();
+    if (pathOrigin != position || pathTarget != playerLastPosition || pathRevision != revision) {
+        // Маршрут по входам кластеров годен, пока граф не изменился и игрок в том же
+        // кластере; тогда поиск идёт только внутри кластера, где стоит враг
+        int playerCluster = terrain->inBounds(playerLastPosition) ? navigation->getCluster(playerLastPosition) : -1;
+        if (routeRevision != revision || routeCluster != playerCluster) {
+            route.clear();
+            routeRevision = revision;
+            routeCluster = playerCluster;
+        }
+        pathFound = navigation->followRoute(position, playerLastPosition, route, *terrain, pathHint);
+        if (!pathFound) {
+            // Маршрута нет или он не ведёт отсюда - ищем по абстрактному графу заново
+            pathFound = navigation->findRoute(position, playerLastPosition, *terrain, route) &&
+                        navigation->followRoute(position, playerLastPosition, route, *terrain, pathHint);
+        }
+        pathOrigin = position;
+        pathTarget = playerLastPosition;
+        pathRevision = revision;
+    }
+    return pathFound;
+}
+
+Direction EnemyTank::getMoveDirection() {
+    // Путь огибает препятствия; без него идем напрямую
+    return findPath() ? pathHint : getDirectionToPlayer();
+}
+
+bool EnemyTank::hasTargeting() const {
+    // Кэш годен, пока танк не сдвинулся с позиции, для которой он считался
+    return targetingValid && targetingOrigin == position;
 }
 
 void EnemyTank::update() {
@@ -71,43 +149,13 @@ Point EnemyTank::getBounds() const {
 }
 
 char EnemyTank::getSymbol() const {
-    // Символ вражеского танка в зависимости от типа и направления
-    char baseSymbol = 'E';
-    
-    // Выбираем базовый символ в зависимости от типа танка
-    switch(tankType) {
-        case EnemyTankType::FAST:
-            baseSymbol = 'F';
-            break;
-        case EnemyTankType::DAMAGE:
-            baseSymbol = 'D';
-            break;
-        case EnemyTankType::ARMORED:
-            baseSymbol = 'A';
-            break;
-        case EnemyTankType::BASIC:
-        default:
-            baseSymbol = 'E';
-            break;
-    }
-    
-    // Модифицируем символ в зависимости от направления
-    switch(direction) {
-        case Direction::UP: 
-            return baseSymbol;
-        case Direction::DOWN: 
-            return baseSymbol;
-        case Direction::LEFT: 
-            return baseSymbol;
-        case Direction::RIGHT: 
-            return baseSymbol;
-        default: 
-            return baseSymbol;
-    }
+    // Символ вражеского танка зависит только от типа
+    return EnemyArchetypes::get(tankType).symbol;
 }
 
 bool EnemyTank::canSeePlayer() const {
     if (playerLastPosition.x == -1) return false;
+    if (hasTargeting()) return cachedAligned;
     
     return (position.x == playerLastPosition.x || 
             position.y == playerLastPosition.y);
@@ -115,6 +163,7 @@ bool EnemyTank::canSeePlayer() const {
 
 Direction EnemyTank::getDirectionToPlayer() const {
     if (playerLastPosition.x == -1) return direction;
+    if (hasTargeting()) return cachedDirection;
     
     int dx = playerLastPosition.x - position.x;
     int dy = playerLastPosition.y - position.y;
@@ -128,6 +177,7 @@ Direction EnemyTank::getDirectionToPlayer() const {
 
 int EnemyTank::getDistanceToPlayer() const {
     if (playerLastPosition.x == -1) return -1;
+    if (hasTargeting()) return cachedDistance;
     
     return abs(position.x - playerLastPosition.x) + 
            abs(position.y - playerLastPosition.y);
@@ -136,31 +186,26 @@ int EnemyTank::getDistanceToPlayer() const {
 Projectile* EnemyTank::fire() {
     if (!canFire()) return nullptr;
     
-    int projectileDamage = 1; // Базовый урон
-    
-    // Увеличиваем урон для DAMAGE танков
-    if (tankType == EnemyTankType::DAMAGE) {
-        projectileDamage = 2;
-    }
+    int projectileDamage = EnemyArchetypes::get(tankType).damage;
     
     // Вражеские танки имеют разную точность в зависимости от сложности
-    if (difficulty == 1 && rand() % 3 == 0) { // 33% шанс промаха
+    if (difficulty == 1 && roll(3) == 0) { // 33% шанс промаха
         // Стреляем в случайном направлении
-        Direction randomDir = static_cast<Direction>(rand() % 4);
+        Direction randomDir = static_cast<Direction>(roll(4));
         rotate(randomDir);
-    } else if (difficulty == 2 && rand() % 5 == 0) { // 20% шанс промаха
+    } else if (difficulty == 2 && roll(5) == 0) { // 20% шанс промаха
         // Небольшое отклонение
         Direction nearDir = getDirectionToPlayer();
-        if (rand() % 2 == 0) {
+        if (roll(2) == 0) {
             // Слегка отклоняемся
             switch (nearDir) {
                 case Direction::UP: 
                 case Direction::DOWN:
-                    rotate(rand() % 2 == 0 ? Direction::LEFT : Direction::RIGHT);
+                    rotate(roll(2) == 0 ? Direction::LEFT : Direction::RIGHT);
                     break;
                 case Direction::LEFT:
                 case Direction::RIGHT:
-                    rotate(rand() % 2 == 0 ? Direction::UP : Direction::DOWN);
+                    rotate(roll(2) == 0 ? Direction::UP : Direction::DOWN);
                     break;
             }
         }
@@ -192,7 +237,12 @@ void EnemyTank::decideNextMove() {
 
     // Если игрок не обнаружен, используем случайное поведение
     if (playerLastPosition.x == -1 || !canSeePlayer()) {
-        randomBehavior();
+        // Агрессивный танк с известным путем выслеживает игрока
+        if (behavior == AIBehavior::AGGRESSIVE && findPath()) {
+            moveTowardsPlayer();
+        } else {
+            randomBehavior();
+        }
         return;
     }
 
@@ -218,12 +268,12 @@ void EnemyTank::move(Direction dir) {
 }
 
 void EnemyTank::randomBehavior() {
-    // 70% шанс движения, 30% шанс смены направления
-    if (rand() % 10 < 7) {
+    // По умолчанию 70% шанс движения, 30% шанс смены направления
+    if (roll(100) < params().wanderMoveChance) {
         // Двигаемся в текущем направлении
     } else {
         // Случайно меняем направление
-        Direction newDir = static_cast<Direction>(rand() % 4);
+        Direction newDir = static_cast<Direction>(roll(4));
         rotate(newDir);
     }
 }
@@ -232,10 +282,10 @@ void EnemyTank::aggressiveBehavior() {
     Direction toPlayer = getDirectionToPlayer();
     int distance = getDistanceToPlayer();
     
-    if (distance <= 3) {
+    if (distance <= params().retreatDistance) {
         // Близкая дистанция - отступаем
         defensiveMove();
-    } else if (distance <= 6) {
+    } else if (distance <= params().engageDistance) {
         // Средняя дистанция - стремимся к оптимальной позиции
         if (canFire() && hasClearShot()) {
             // Уже в хорошей позиции - остаемся на месте
@@ -254,15 +304,15 @@ void EnemyTank::defensiveBehavior() {
     Direction toPlayer = getDirectionToPlayer();
     int distance = getDistanceToPlayer();
     
-    if (distance <= 2) {
+    if (distance <= params().defensiveRetreatDistance) {
         // Слишком близко - отступаем
         defensiveMove();
-    } else if (distance <= 5) {
+    } else if (distance <= params().defensiveHoldDistance) {
         // Идеальная дистанция для обороны
-        if (hasClearShot()) {
+        if (canFire() && hasClearShot()) {
             rotate(toPlayer);
         } else {
-            // Ищем укрытие или лучшую позицию
+            // Под огнем без ответного выстрела (перезарядка, стена между нами) - ищем укрытие
             findCover();
         }
     } else {
@@ -272,10 +322,10 @@ void EnemyTank::defensiveBehavior() {
 }
 
 void EnemyTank::moveTowardsPlayer() {
-    Direction toPlayer = getDirectionToPlayer();
+    Direction toPlayer = getMoveDirection();
     
-    // 80% шанс движения к игроку, 20% - случайное движение
-    if (rand() % 10 < 8) {
+    // По умолчанию 80% шанс движения к игроку, 20% - случайное движение
+    if (roll(100) < params().approachChance) {
         rotate(toPlayer);
         move(toPlayer);
     } else {
@@ -286,27 +336,37 @@ void EnemyTank::moveTowardsPlayer() {
 void EnemyTank::defensiveMove() {
     Direction toPlayer = getDirectionToPlayer();
     Direction awayFromPlayer = getOppositeDirection(toPlayer);
+    Direction retreat = awayFromPlayer;
     
-    // Двигаемся от игрока
-    rotate(awayFromPlayer);
-    move(awayFromPlayer);
+    // Прямой отход по линии огня оставляет танк под выстрелом - уходим в
+    // наименее опасную соседнюю клетку, при равной опасности - все же назад
+    Point back = stepFrom(position, awayFromPlayer);
+    Direction safe;
+    if (dangerMap && (dangerMap->isOnFireLine(back) || !dangerMap->isPassable(back)) &&
+        dangerMap->findSafeDirection(position, toPlayer, safe)) {
+        if (!dangerMap->isPassable(back) ||
+            dangerMap->getDanger(stepFrom(position, safe)) < dangerMap->getDanger(back)) {
+            retreat = safe;
+        }
+    }
     
-    // Поворачиваемся к игроку для возможного выстрела
-    rotate(toPlayer);
+    // Двигаемся от игрока; к игроку танк развернёт attemptShot, если будет стрелять
+    move(retreat);
 }
 
 void EnemyTank::cautiousApproach() {
     Direction toPlayer = getDirectionToPlayer();
     int distance = getDistanceToPlayer();
     
-    if (distance > 8) {
+    if (distance > params().cautiousDistance) {
         // Быстрое приближение на больших дистанциях
         moveTowardsPlayer();
     } else {
         // Медленное осторожное приближение
-        if (rand() % 3 == 0) { // 33% шанс движения
-            rotate(toPlayer);
-            move(toPlayer);
+        if (roll(100) < params().cautiousMoveChance) {
+            Direction step = getMoveDirection();
+            rotate(step);
+            move(step);
         } else {
             // Остаемся на месте, но следим за игроком
             rotate(toPlayer);
@@ -317,8 +377,17 @@ void EnemyTank::cautiousApproach() {
 void EnemyTank::findCover() {
     Direction toPlayer = getDirectionToPlayer();
     
-    // 50% шанс движения перпендикулярно направлению к игроку
-    if (rand() % 2 == 0) {
+    // Уходим с линий огня игрока в наименее опасную соседнюю клетку
+    Direction cover;
+    if (dangerMap && dangerMap->isOnFireLine(position) &&
+        dangerMap->findSafeDirection(position, toPlayer, cover)) {
+        rotate(cover);
+        move(cover);
+        return;
+    }
+    
+    // По умолчанию 50% шанс движения перпендикулярно направлению к игроку
+    if (roll(100) < params().coverSidestepChance) {
         Direction perpendicular = getPerpendicularDirection(toPlayer);
         rotate(perpendicular);
         move(perpendicular);
@@ -331,22 +400,11 @@ void EnemyTank::findCover() {
 void EnemyTank::attemptShot() {
     if (!canFire()) return;
     
-    int shotChance = 0;
-    
     // Вероятность выстрела в зависимости от поведения и сложности
-    switch (behavior) {
-        case AIBehavior::AGGRESSIVE:
-            shotChance = 70 + (difficulty * 10); // 70-90%
-            break;
-        case AIBehavior::DEFENSIVE:
-            shotChance = 40 + (difficulty * 10); // 40-60%
-            break;
-        case AIBehavior::RANDOM:
-            shotChance = 30 + (difficulty * 10); // 30-50%
-            break;
-    }
+    int shotChance = EnemyArchetypes::getShotChance(behavior, difficulty) +
+                     params().shotChanceBonus;
     
-    if (hasClearShot() && (rand() % 100 < shotChance)) {
+    if (hasClearShot() && (roll(100) < shotChance)) {
         rotate(getDirectionToPlayer());
         fire();
     }
@@ -367,29 +425,95 @@ Direction EnemyTank::getPerpendicularDirection(Direction dir) const {
     switch (dir) {
         case Direction::UP:
         case Direction::DOWN:
-            return (rand() % 2 == 0) ? Direction::LEFT : Direction::RIGHT;
+            return (roll(2) == 0) ? Direction::LEFT : Direction::RIGHT;
         case Direction::LEFT:
         case Direction::RIGHT:
-            return (rand() % 2 == 0) ? Direction::UP : Direction::DOWN;
+            return (roll(2) == 0) ? Direction::UP : Direction::DOWN;
         default: return dir;
     }
 }
 
 bool EnemyTank::hasClearShot() const {
-    if (playerLastPosition.x == -1) return false;
+    if (!canSeePlayer()) return false;
+    if (!terrain || position == playerLastPosition) return true;
     
-    Point start = position;
-    Point target = playerLastPosition;
-    
-    if (start.x == target.x) {
-        return true;
-    } else if (start.y == target.y) {
-        return true;
+    // На одной линии с игроком, но стена между нами примет снаряд на себя
+    Direction toPlayer = getDirectionToPlayer();
+    for (Point cell = stepFrom(position, toPlayer);
+         cell != playerLastPosition && terrain->inBounds(cell);
+         cell = stepFrom(cell, toPlayer)) {
+        if (terrain->blocksProjectiles(cell)) return false;
     }
-    
-    return false;
+    return true;
 }
 
 EnemyTankType EnemyTank::getTankType() const {
     return tankType;
 }
+
+void EnemyTank::save(BinaryWriter& out) const {
+    Tank::save(out);
+    out.writeInt(static_cast<int>(behavior));
+    out.writeInt(difficulty);
+    out.writeInt(static_cast<int>(tankType));
+    out.writeInt(playerLastPosition.x);
+    out.writeInt(playerLastPosition.y);
+    out.writeInt(moveCooldown);
+
+    // Кэши наведения и пути тоже сохраняем: восстановленная игра идёт так же, как шла бы
+    out.writeInt(cachedDistance);
+    out.writeInt(static_cast<int>(cachedDirection));
+    out.writeBool(cachedAligned);
+    out.writeBool(targetingValid);
+    out.writeInt(targetingOrigin.x);
+    out.writeInt(targetingOrigin.y);
+    out.writeInt(static_cast<int>(pathHint));
+    out.writeBool(pathFound);
+    out.writeInt(pathOrigin.x);
+    out.writeInt(pathOrigin.y);
+    out.writeInt(pathTarget.x);
+    out.writeInt(pathTarget.y);
+    out.writeInt(static_cast<int>(pathRevision));
+    out.writeInt(static_cast<int>(route.size()));
+    for (const Point& entrance : route) {
+        out.writeInt(entrance.x);
+        out.writeInt(entrance.y);
+    }
+    out.writeInt(routeCluster);
+    out.writeInt(static_cast<int>(routeRevision));
+}
+
+void EnemyTank::load(BinaryReader& in) {
+    Tank::load(in);
+    behavior = static_cast<AIBehavior>(in.readInt(0, 2));
+    difficulty = in.readInt();
+    tankType = static_cast<EnemyTankType>(in.readInt(0, EnemyArchetypes::TYPE_COUNT - 1));
+    playerLastPosition.x = in.readInt();
+    playerLastPosition.y = in.readInt();
+    moveCooldown = in.readInt();
+
+    cachedDistance = in.readInt();
+    cachedDirection = static_cast<Direction>(in.readInt(0, 3));
+    cachedAligned = in.readBool();
+    targetingValid = in.readBool();
+    targetingOrigin.x = in.readInt();
+    targetingOrigin.y = in.readInt();
+    pathHint = static_cast<Direction>(in.readInt(0, 3));
+    pathFound = in.readBool();
+    pathOrigin.x = in.readInt();
+    pathOrigin.y = in.readInt();
+    pathTarget.x = in.readInt();
+    pathTarget.y = in.readInt();
+    // Ревизии сохраняются вместе с графом, так что кэши остаются годными
+    pathRevision = static_cast<unsigned int>(in.readInt(0, INT_MAX));
+    int routeLength = in.readInt(0, INT_MAX);
+    route.clear();
+    for (int i = 0; i < routeLength && in.ok(); i++) {
+        Point entrance;
+        entrance.x = in.readInt();
+        entrance.y = in.readInt();
+        route.push_back(entrance);
+    }
+    routeCluster = in.readInt();
+    routeRevision = static_cast<unsigned int>(in.readInt(0, INT_MAX));
+}
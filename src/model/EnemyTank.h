@@ -13,7 +13,11 @@
 #define ENEMYTANK_H
 
 #include "Tank.h"
+#include "DangerMap.h"
+#include "AIParams.h"
+#include "NavGraph.h"
 #include <stdlib.h>
+#include <random>
 
 /**
  * @brief Enumeration representing AI behavior patterns.
@@ -43,19 +47,44 @@ private:
     EnemyTankType tankType;          ///< Type of enemy tank
     Point playerLastPosition;        ///< Last known player position
     int moveCooldown;                ///< Cooldown timer for movement
+
+    int cachedDistance;              ///< Distance to player from last batch pass
+    Direction cachedDirection;       ///< Direction to player from last batch pass
+    bool cachedAligned;              ///< Row/column alignment from last batch pass
+    bool targetingValid;             ///< Whether cached targeting is up to date
+    Point targetingOrigin;           ///< Position the cached targeting was computed for
+    const DangerMap* dangerMap;      ///< Danger map of the world (may be null)
+    const AIParams* aiParams;        ///< AI parameters of the world (may be null)
+    std::mt19937* rng;               ///< Random generator of the world (may be null)
+    const NavGraph* navigation;      ///< Navigation graph of the world (may be null)
+    const TerrainGrid* terrain;      ///< Terrain the navigation graph was built for
+    Direction pathHint;              ///< First step of navigation path to player
+    bool pathFound;                  ///< Whether navigation found a path
+    Point pathOrigin;                ///< Position the path hint was computed for
+    Point pathTarget;                ///< Player position the path hint was computed for
+    unsigned int pathRevision;       ///< Navigation revision the path hint was computed for, 0 if none
+    std::vector<Point> route;        ///< Cluster entrances towards the player, refined one cluster at a time
+    int routeCluster;                ///< Cluster of the player the route leads to
+    unsigned int routeRevision;      ///< Navigation revision the route was found for, 0 if none
+    
+    bool hasTargeting() const;       ///< Checks if cached targeting can be used
+    const AIParams& params() const;  ///< Gets AI parameters (defaults if not set)
+    int roll(int range) const;       ///< Random value in [0, range)
+    bool findPath();                 ///< Queries navigation unless hint is current
+    Direction getMoveDirection();    ///< Path direction, or greedy direction without a path
     
     void decideNextMove();           ///< Decides next action based on behavior
     void randomBehavior();           ///< Executes random movement behavior
     void aggressiveBehavior();       ///< Executes aggressive behavior
     void defensiveBehavior();        ///< Executes defensive behavior
     void moveTowardsPlayer();        ///< Moves towards player position
-    void defensiveMove();            ///< Moves away from player
+    void defensiveMove();            ///< Retreats from player, off its fire lines
     void cautiousApproach();         ///< Carefully approaches player
     void findCover();                ///< Searches for cover
     void attemptShot();              ///< Attempts to shoot at player
     Direction getOppositeDirection(Direction dir) const;   ///< Gets opposite direction
     Direction getPerpendicularDirection(Direction dir) const;  ///< Gets perpendicular direction
-    bool hasClearShot() const;       ///< Checks if tank has clear line of sight to player
+    bool hasClearShot() const;       ///< Checks if player is aligned with no wall in between
 
 public:
     /**
@@ -74,6 +103,38 @@ public:
      * @returns None
      */
     void setPlayerPosition(Point playerPos);
+
+    /**
+     * @brief Stores targeting computed by the batch pass of the world.
+     * @param distance Manhattan distance to player.
+     * @param dir Direction towards player.
+     * @param aligned Whether tank shares a row or column with player.
+     * @returns None
+     */
+    void setTargeting(int distance, Direction dir, bool aligned);
+
+    /**
+     * @brief Sets danger map used to pick cover.
+     * @param map Danger map of the world.
+     * @returns None
+     */
+    void setDangerMap(const DangerMap* map);
+
+    /**
+     * @brief Sets AI parameters and random generator used for decisions.
+     * @param params AI parameters of the world.
+     * @param generator Random generator of the world.
+     * @returns None
+     */
+    void setAIContext(const AIParams* params, std::mt19937* generator);
+
+    /**
+     * @brief Sets navigation graph used to move around obstacles.
+     * @param graph Navigation graph of the world.
+     * @param grid Terrain grid of the world.
+     * @returns None
+     */
+    void setNavigation(const NavGraph* graph, const TerrainGrid* grid);
     
     /**
      * @brief Updates enemy tank state and AI decisions.
@@ -136,6 +197,9 @@ public:
      * @returns None
      */
     void applySlowEffect(int duration);
+
+    void save(BinaryWriter& out) const override;
+    void load(BinaryReader& in) override;
 };
 
 #endif // ENEMYTANK_H
@@ -0,0 +1,85 @@
+/**
+ * @file EnemyTargeting.cpp
+ * @author Vld251
+ * @brief Implementation of batch distance, direction and alignment kernels for enemies.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "EnemyTargeting.h"
+#include "EnemyTank.h"
+
+void EnemyTargeting::clear() {
+    enemies.clear();
+    posX.clear();
+    posY.clear();
+}
+
+void EnemyTargeting::add(EnemyTank* enemy) {
+    Point pos = enemy->getPosition();
+    enemies.push_back(enemy);
+    posX.push_back(pos.x);
+    posY.push_back(pos.y);
+}
+
+void EnemyTargeting::compute(Point target) {
+    size_t count = enemies.size();
+    distance.resize(count);
+    direction.resize(count);
+    aligned.resize(count);
+
+    if (count == 0) return;
+
+    computeDistances(posX.data(), posY.data(), count, target, distance.data());
+    computeDirections(posX.data(), posY.data(), count, target, direction.data());
+    computeAlignment(posX.data(), posY.data(), count, target, aligned.data());
+}
+
+void EnemyTargeting::apply() const {
+    for (size_t i = 0; i < enemies.size(); i++) {
+        enemies[i]->setTargeting(distance[i], static_cast<Direction>(direction[i]), aligned[i] != 0);
+    }
+}
+
+size_t EnemyTargeting::size() const {
+    return enemies.size();
+}
+
+// Ядра написаны без ветвлений, чтобы компилятор мог их векторизовать
+
+void EnemyTargeting::computeDistances(const int* xs, const int* ys, size_t count, Point target, int* out) {
+    for (size_t i = 0; i < count; i++) {
+        int dx = xs[i] - target.x;
+        int dy = ys[i] - target.y;
+        int ax = dx < 0 ? -dx : dx;
+        int ay = dy < 0 ? -dy : dy;
+        out[i] = ax + ay;
+    }
+}
+
+void EnemyTargeting::computeDirections(const int* xs, const int* ys, size_t count, Point target, int* out) {
+    const int up = static_cast<int>(Direction::UP);
+    const int down = static_cast<int>(Direction::DOWN);
+    const int left = static_cast<int>(Direction::LEFT);
+    const int right = static_cast<int>(Direction::RIGHT);
+
+    for (size_t i = 0; i < count; i++) {
+        int dx = target.x - xs[i];
+        int dy = target.y - ys[i];
+        int ax = dx < 0 ? -dx : dx;
+        int ay = dy < 0 ? -dy : dy;
+
+        int horizontal = (dx > 0) ? right : left;
+        int vertical = (dy > 0) ? down : up;
+        out[i] = (ax > ay) ? horizontal : vertical;
+    }
+}
+
+void EnemyTargeting::computeAlignment(const int* xs, const int* ys, size_t count, Point target, int* out) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (xs[i] == target.x) | (ys[i] == target.y);
+    }
+}
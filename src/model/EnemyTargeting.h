@@ -0,0 +1,104 @@
+/**
+ * @file EnemyTargeting.h
+ * @author Vld251
+ * @brief Structure-of-arrays targeting state and batch kernels for enemy AI.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef ENEMYTARGETING_H
+#define ENEMYTARGETING_H
+
+#include "GameObject.h"
+#include <vector>
+#include <cstddef>
+
+class EnemyTank;
+
+/**
+ * @brief Batch targeting data for all enemies of the current tick.
+ * 
+ * Enemy positions are gathered into parallel arrays once per tick, so the
+ * distance, axis alignment and direction to the player are computed for all
+ * enemies in one tight loop and then handed back to each EnemyTank.
+ */
+class EnemyTargeting {
+private:
+    std::vector<EnemyTank*> enemies;    ///< Enemies in gather order
+    std::vector<int> posX;              ///< X coordinates of enemies
+    std::vector<int> posY;              ///< Y coordinates of enemies
+    std::vector<int> distance;          ///< Manhattan distance to player
+    std::vector<int> direction;         ///< Direction to player (as Direction value)
+    std::vector<int> aligned;           ///< Non-zero if enemy shares row or column with player
+
+public:
+    /**
+     * @brief Removes all gathered enemies.
+     * @returns None
+     */
+    void clear();
+
+    /**
+     * @brief Gathers enemy position into the arrays.
+     * @param enemy Enemy tank to add.
+     * @returns None
+     */
+    void add(EnemyTank* enemy);
+
+    /**
+     * @brief Runs targeting kernels for all gathered enemies.
+     * @param target Current player position.
+     * @returns None
+     */
+    void compute(Point target);
+
+    /**
+     * @brief Writes computed targeting back to each enemy.
+     * @returns None
+     */
+    void apply() const;
+
+    /**
+     * @brief Gets number of gathered enemies.
+     * @return Number of enemies.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Computes Manhattan distances from positions to target.
+     * @param xs X coordinates.
+     * @param ys Y coordinates.
+     * @param count Number of positions.
+     * @param target Target point.
+     * @param out Output distances.
+     * @returns None
+     */
+    static void computeDistances(const int* xs, const int* ys, size_t count, Point target, int* out);
+
+    /**
+     * @brief Computes dominant-axis direction from positions to target.
+     * @param xs X coordinates.
+     * @param ys Y coordinates.
+     * @param count Number of positions.
+     * @param target Target point.
+     * @param out Output directions (Direction values).
+     * @returns None
+     */
+    static void computeDirections(const int* xs, const int* ys, size_t count, Point target, int* out);
+
+    /**
+     * @brief Computes row/column alignment of positions with target.
+     * @param xs X coordinates.
+     * @param ys Y coordinates.
+     * @param count Number of positions.
+     * @param target Target point.
+     * @param out Output flags (1 if aligned, 0 otherwise).
+     * @returns None
+     */
+    static void computeAlignment(const int* xs, const int* ys, size_t count, Point target, int* out);
+};
+
+#endif // ENEMYTARGETING_H
@@ -10,6 +10,7 @@
  */
 
 #include "Explosion.h"
+#include "BinaryStream.h"
 
 Explosion::Explosion(Point pos) 
     : GameObject(pos, Direction::UP, 0, 1, true), lifetime(1) {}
@@ -28,3 +29,13 @@ Point Explosion::getBounds() const {
 char Explosion::getSymbol() const {
     return 'O';
 }
+
+void Explosion::save(BinaryWriter& out) const {
+    GameObject::save(out);
+    out.writeInt(lifetime);
+}
+
+void Explosion::load(BinaryReader& in) {
+    GameObject::load(in);
+    lifetime = in.readInt();
+}
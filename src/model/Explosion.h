@@ -49,6 +49,9 @@ public:
      * @return Character symbol for display.
      */
     char getSymbol() const override;
+
+    void save(BinaryWriter& out) const override;
+    void load(BinaryReader& in) override;
 };
 
 #endif // EXPLOSION_H
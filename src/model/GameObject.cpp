@@ -10,6 +10,7 @@
  */
 
 #include "GameObject.h"
+#include "BinaryStream.h"
 
 Point::Point(int x, int y) : x(x), y(y) {}
 
@@ -93,3 +94,21 @@ void GameObject::setPosition(Point newPos) {
 void GameObject::setHealth(int newHealth) { 
     health = newHealth; 
 }
+
+void GameObject::save(BinaryWriter& out) const {
+    out.writeInt(position.x);
+    out.writeInt(position.y);
+    out.writeInt(static_cast<int>(direction));
+    out.writeInt(speed);
+    out.writeInt(health);
+    out.writeBool(destructible);
+}
+
+void GameObject::load(BinaryReader& in) {
+    position.x = in.readInt();
+    position.y = in.readInt();
+    direction = static_cast<Direction>(in.readInt(0, 3));
+    speed = in.readInt();
+    health = in.readInt();
+    destructible = in.readBool();
+}
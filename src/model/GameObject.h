@@ -12,6 +12,9 @@
 #ifndef GAMEOBJECT_H
 #define GAMEOBJECT_H
 
+class BinaryWriter;
+class BinaryReader;
+
 /**
  * @brief Structure representing a 2D point with integer coordinates.
  */
@@ -172,6 +175,22 @@ public:
      * @returns None
      */
     void setHealth(int newHealth);
+
+    /**
+     * @brief Writes object state for a saved game.
+     * @param out Output buffer.
+     * @returns None
+     */
+    virtual void save(BinaryWriter& out) const;
+
+    /**
+     * @brief Restores object state written by save().
+     * 
+     * Errors are reported through the reader.
+     * @param in Input buffer.
+     * @returns None
+     */
+    virtual void load(BinaryReader& in);
 };
 
 #endif // GAMEOBJECT_H
@@ -10,6 +10,8 @@
  */
 
 #include "GameWorld.h"
+#include "EnemyArchetypes.h"
+#include "BinaryStream.h"
 #include <cstdlib>
 #include <ctime>
 
@@ -19,18 +21,62 @@
 #include <random>
 #include <cmath>
 #include <map>
+#include <sstream>
+#include <climits>
+
+namespace {
+
+const char SAVE_MAGIC[4] = { 'T', 'K', 'S', 'V' };
+
+// Вид объекта в сохранении: по нему при загрузке выбирается класс
+enum class SavedObject { PLAYER, ENEMY, OBSTACLE };
+
+// Индекс танка в списке объектов, -1 если его там нет (уже удалён)
+int indexOf(const std::vector<std::unique_ptr<GameObject>>& objects, const GameObject* object) {
+    for (size_t i = 0; i < objects.size(); i++) {
+        if (objects[i].get() == object) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void saveAIParams(BinaryWriter& out, const AIParams& params) {
+    out.writeInt(params.wanderMoveChance);
+    out.writeInt(params.approachChance);
+    out.writeInt(params.cautiousMoveChance);
+    out.writeInt(params.coverSidestepChance);
+    out.writeInt(params.shotChanceBonus);
+    out.writeInt(params.retreatDistance);
+    out.writeInt(params.engageDistance);
+    out.writeInt(params.defensiveRetreatDistance);
+    out.writeInt(params.defensiveHoldDistance);
+    out.writeInt(params.cautiousDistance);
+}
+
+void loadAIParams(BinaryReader& in, AIParams& params) {
+    params.wanderMoveChance = in.readInt();
+    params.approachChance = in.readInt();
+    params.cautiousMoveChance = in.readInt();
+    params.coverSidestepChance = in.readInt();
+    params.shotChanceBonus = in.readInt();
+    params.retreatDistance = in.readInt();
+    params.engageDistance = in.readInt();
+    params.defensiveRetreatDistance = in.readInt();
+    params.defensiveHoldDistance = in.readInt();
+    params.cautiousDistance = in.readInt();
+}
+
+}
 
 GameWorld::GameWorld(int width, int height) 
-    : fieldWidth(40), fieldHeight(20), state(GameState::MENU), 
+    : fieldWidth(width), fieldHeight(height), state(GameState::MENU), 
       currentLevel(1), player(nullptr), enemyCount(0), maxEnemies(5),
-      damageFlashCounter(0) {
+      damageFlashCounter(0),
+      rng(static_cast<unsigned int>(std::time(nullptr))) {
     // Создаем игрока в центре нижней части поля
     Point playerPos(width / 2, height - 3);
     player = new PlayerTank(playerPos);
     objects.emplace_back(player);
-    
-    // Инициализация случайного генератора
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+    refreshTerrain();
 }
 
 void GameWorld::update() {
@@ -41,6 +87,9 @@ void GameWorld::update() {
         damageFlashCounter--;
     }
     
+    // Старим зоны взрывов на карте опасности
+    danger.tick();
+    
     updateEnemyAI();
 
     // Обновляем все объекты
@@ -61,6 +110,7 @@ void GameWorld::update() {
             Projectile* projectile = enemy->fire();
             if (projectile) {
                 projectiles.emplace_back(projectile);
+                drawBandAt(projectile->getPosition()).projectiles.push_back(projectile);
             }
         }
     }
@@ -79,7 +129,7 @@ void GameWorld::update() {
     cleanupDestroyedObjects();
     
     // Спауним бонусы с случайным шансом
-    if (std::rand() % 100 < 5) { 
+    if (std::uniform_int_distribution<>(0, 99)(rng) < 5) { 
         spawnBonus(); 
     }
     
@@ -111,9 +161,125 @@ void GameWorld::loadLevel(int level) {
     // Создаем врагов в зависимости от уровня
     createEnemies(level);
     
+    refreshTerrain();
+    
     state = GameState::PLAYING;
 }
 
+void GameWorld::refreshTerrain() {
+    buildTerrain();
+    danger.reset(terrain);
+    navigation.build(terrain);
+    rebuildTankList();
+}
+
+void GameWorld::buildTerrain() {
+    terrain.reset(fieldWidth, fieldHeight);
+    terrainLayer.assign(static_cast<size_t>(fieldWidth) * fieldHeight, ' ');
+    
+    for (const auto& obj : objects) {
+        Obstacle* obstacle = dynamic_cast<Obstacle*>(obj.get());
+        if (obstacle && !obstacle->isDestroyed()) {
+            Point pos = obstacle->getPosition();
+            terrain.setObstacle(pos, obstacle->getType());
+            if (terrain.inBounds(pos)) {
+                terrainLayer[pos.y * fieldWidth + pos.x] = obstacle->getSymbol();
+            }
+        }
+    }
+}
+
+void GameWorld::rebuildTankList() {
+    tanks.clear();
+
+    // Раньше объекты рисовались по порядку списка: танк, добавленный до
+    // препятствий (например, игрок), оказывается под лесом
+    bool obstacleAfter = false;
+    for (auto it = objects.rbegin(); it != objects.rend(); ++it) {
+        Tank* tank = dynamic_cast<Tank*>(it->get());
+        if (tank) {
+            DrawnTank entry = { tank, obstacleAfter };
+            tanks.push_back(entry);
+        } else if (dynamic_cast<Obstacle*>(it->get())) {
+            obstacleAfter = true;
+        }
+    }
+    std::reverse(tanks.begin(), tanks.end());
+    indexDrawables();
+}
+
+const int GameWorld::DRAW_BAND_ROWS;
+
+void GameWorld::indexDrawables() {
+    drawBands.assign(static_cast<size_t>((fieldHeight + DRAW_BAND_ROWS - 1) / DRAW_BAND_ROWS), DrawBand());
+    playerTanks.clear();
+
+    // Объекты двигаются только в update(), после которого полосы перестраиваются;
+    // игрок двигается и между ними, поэтому хранится отдельно
+    for (const DrawnTank& entry : tanks) {
+        if (entry.tank == player) {
+            playerTanks.push_back(entry);
+        } else {
+            drawBandAt(entry.tank->getPosition()).tanks.push_back(entry);
+        }
+    }
+    for (const auto& proj : projectiles) {
+        drawBandAt(proj->getPosition()).projectiles.push_back(proj.get());
+    }
+    for (const auto& bonus : bonuses) {
+        drawBandAt(bonus->getPosition()).bonuses.push_back(bonus.get());
+    }
+    for (const auto& explosion : explosions) {
+        drawBandAt(explosion->getPosition()).explosions.push_back(explosion.get());
+    }
+}
+
+GameWorld::DrawBand& GameWorld::drawBandAt(const Point& pos) {
+    int band = pos.y / DRAW_BAND_ROWS;
+    band = std::max(0, std::min(band, static_cast<int>(drawBands.size()) - 1));
+    return drawBands[band];
+}
+
+const NavGraph& GameWorld::getNavigation() const {
+    return navigation;
+}
+
+const TerrainGrid& GameWorld::getTerrain() const {
+    return terrain;
+}
+
+void GameWorld::setSeed(unsigned int seed) {
+    rng.seed(seed);
+}
+
+void GameWorld::setAIParams(const AIParams& params) {
+    aiParams = params;
+}
+
+const AIParams& GameWorld::getAIParams() const {
+    return aiParams;
+}
+
+const DangerMap& GameWorld::getDangerMap() const {
+    return danger;
+}
+
+void GameWorld::spawnExplosion(const Point& pos) {
+    explosions.emplace_back(new Explosion(pos));
+    drawBandAt(pos).explosions.push_back(explosions.back().get());
+    danger.addBlast(pos);
+}
+
+void GameWorld::onObstacleDestroyed(const Obstacle* obstacle) {
+    Point pos = obstacle->getPosition();
+    terrain.clearCell(pos);
+    danger.updateCell(pos, terrain);
+    navigation.updateCell(pos, terrain);
+    if (terrain.inBounds(pos)) {
+        terrainLayer[pos.y * fieldWidth + pos.x] = ' ';
+    }
+}
+
 void GameWorld::checkCollisions() {
     if (!player) return;
     
@@ -170,13 +336,13 @@ void GameWorld::checkProjectileCollisions() {
                     
                     // Используем точку, которая ближе к границе
                     if (distLastToBorder < distCurrentToBorder) {
-                        explosions.emplace_back(new Explosion(lastValidPoint));
+                        spawnExplosion(lastValidPoint);
                     } else {
-                        explosions.emplace_back(new Explosion(explosionPoint));
+                        spawnExplosion(explosionPoint);
                     }
                 } else {
                     // Если первая точка уже за границей, создаем взрыв на границе
-                    explosions.emplace_back(new Explosion(explosionPoint));
+                    spawnExplosion(explosionPoint);
                 }
                 hit = true;
                 break;
@@ -230,7 +396,8 @@ bool GameWorld::handleProjectileHit(GameObject* target, Projectile* projectile,
             obstacle->takeDamage(damage);
             
             if (!wasDestroyed && obstacle->isDestroyed()) {
-                explosions.emplace_back(new Explosion(obstacle->getPosition()));
+                spawnExplosion(obstacle->getPosition());
+                onObstacleDestroyed(obstacle);
             }
 
             // Начисляем очки за разрушение препятствия
@@ -262,30 +429,16 @@ bool GameWorld::handleProjectileHit(GameObject* target, Projectile* projectile,
         tank->takeDamage(damage);
         
         if (!wasDestroyed && tank->isDestroyed()) {
-            explosions.emplace_back(new Explosion(tank->getPosition()));
+            spawnExplosion(tank->getPosition());
         }
 
         // Начисляем очки игроку за уничтожение врага с бонусами за тип танка
         if (tank != player && tank->isDestroyed() && owner == player) {
             int baseScore = 100;
             
-            // Бонусные очки за специальные типы танков
+            // Очки за тип танка берем из таблицы архетипов
             if (hitEnemy) {
-                switch(hitEnemy->getTankType()) {
-                    case EnemyTankType::FAST:
-                        baseScore = 150; // +50 очков за быстрый танк
-                        break;
-                    case EnemyTankType::DAMAGE:
-                        baseScore = 200; // +100 очков за танк с уроном
-                        break;
-                    case EnemyTankType::ARMORED:
-                        baseScore = 250; // +150 очков за бронированный танк
-                        break;
-                    case EnemyTankType::BASIC:
-                    default:
-                        baseScore = 100;
-                        break;
-                }
+                baseScore = EnemyArchetypes::get(hitEnemy->getTankType()).score;
             }
             
             player->addScore(baseScore);
@@ -504,8 +657,7 @@ bool GameWorld::checkPointCollision(const Point& point, GameObject* excludeObj)
 
 void GameWorld::spawnBonus() {
     // Генерируем случайную позицию для бонуса
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    std::mt19937& gen = rng;
     std::uniform_int_distribution<> xDist(1, fieldWidth - 2);
     std::uniform_int_distribution<> yDist(1, fieldHeight - 2);
     
@@ -534,6 +686,7 @@ void GameWorld::spawnBonus() {
     
     // Создаем бонус
     bonuses.emplace_back(new Bonus(bonusPos, type));
+    drawBandAt(bonusPos).bonuses.push_back(bonuses.back().get());
 }
 
 bool GameWorld::isValidBonusPosition(const Point& pos) const {
@@ -684,23 +837,29 @@ int GameWorld::getCurrentLevel() const {
 void GameWorld::addObject(std::unique_ptr<GameObject> obj) {
     objects.push_back(std::move(obj));
     
-    // Обновляем счетчик врагов
+    // Обновляем счетчик врагов и список танков
     if (dynamic_cast<EnemyTank*>(objects.back().get())) { enemyCount++; }
+    rebuildTankList();
 }
 
 void GameWorld::addProjectile(std::unique_ptr<Projectile> proj) { 
     projectiles.push_back(std::move(proj)); 
+    drawBandAt(projectiles.back()->getPosition()).projectiles.push_back(projectiles.back().get());
 }
 
 void GameWorld::addBonus(std::unique_ptr<Bonus> bonus) { 
     bonuses.push_back(std::move(bonus)); 
+    drawBandAt(bonuses.back()->getPosition()).bonuses.push_back(bonuses.back().get());
 }
 
 void GameWorld::playerFire() {
     if (state != GameState::PLAYING) return;
     
     Projectile* projectile = player->fire();
-    if (projectile) { projectiles.emplace_back(projectile); }
+    if (projectile) {
+        projectiles.emplace_back(projectile);
+        drawBandAt(projectile->getPosition()).projectiles.push_back(projectile);
+    }
 }
 
 void GameWorld::playerMove(Direction dir) {
@@ -882,14 +1041,13 @@ void GameWorld::createEnemies(int level) {
     enemyCount = 0;
     maxEnemies = 3 + level;
     
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    std::mt19937& gen = rng;
     std::uniform_int_distribution<> xDist(2, fieldWidth - 4);
     std::uniform_int_distribution<> yDist(2, fieldHeight / 2); // Враги в верхней части
     std::uniform_int_distribution<> behaviorDist(0, 2);
     
     // Распределение типов танков в зависимости от уровня
-    std::uniform_int_distribution<> typeDist(0, 100);
+    std::uniform_int_distribution<> typeDist(0, EnemyArchetypes::SPAWN_ROLL_RANGE - 1);
     
     for (int i = 0; i < maxEnemies; i++) {
         Point pos(xDist(gen), yDist(gen));
@@ -914,38 +1072,8 @@ void GameWorld::createEnemies(int level) {
         AIBehavior behavior = static_cast<AIBehavior>(behaviorDist(gen));
         int difficulty = std::min(3, level); // Сложность зависит от уровня
         
-        // Определяем тип танка на основе вероятностей
-        EnemyTankType tankType = EnemyTankType::BASIC;
-        int typeRoll = typeDist(gen);
-        
-        if (level >= 2) {
-            if (typeRoll < 50) { // 50% - обычные танки
-                tankType = EnemyTankType::BASIC;
-            } else if (typeRoll < 70) { // 20% - быстрые танки
-                tankType = EnemyTankType::FAST;
-            } else if (typeRoll < 85) { // 15% - танки с уроном
-                tankType = EnemyTankType::DAMAGE;
-            } else { // 15% - бронированные танки
-                tankType = EnemyTankType::ARMORED;
-            }
-        } else {
-            // На первом уровне только обычные танки
-            tankType = EnemyTankType::BASIC;
-        }
-        
-        // На высоких уровнях увеличиваем шанс появления специальных танков
-        if (level >= 4) {
-            typeRoll = typeDist(gen); // Перебрасываем кубик
-            if (typeRoll < 30) { // 30% - обычные
-                tankType = EnemyTankType::BASIC;
-            } else if (typeRoll < 55) { // 25% - быстрые
-                tankType = EnemyTankType::FAST;
-            } else if (typeRoll < 75) { // 20% - с уроном
-                tankType = EnemyTankType::DAMAGE;
-            } else { // 25% - бронированные
-                tankType = EnemyTankType::ARMORED;
-            }
-        }
+        // Определяем тип танка по весам уровня из таблицы архетипов
+        EnemyTankType tankType = EnemyArchetypes::rollType(level, typeDist(gen));
         
         objects.emplace_back(new EnemyTank(pos, behavior, difficulty, tankType));
         enemyCount++;
@@ -954,17 +1082,30 @@ void GameWorld::createEnemies(int level) {
 
 void GameWorld::updateEnemyAI() {
     Point playerPos = player->getPosition();
+    targeting.clear();
+    
+    // Линии огня перестраиваются только если игрок сдвинулся или повернулся
+    danger.trackPlayer(playerPos, player->getDirection());
     
     for (auto& obj : objects) {
         EnemyTank* enemy = dynamic_cast<EnemyTank*>(obj.get());
         if (enemy && !enemy->isDestroyed()) {
             // Обновляем позицию игрока для ИИ врага
             enemy->setPlayerPosition(playerPos);
+            enemy->setDangerMap(&danger);
+            enemy->setAIContext(&aiParams, &rng);
+            enemy->setNavigation(&navigation, &terrain);
             
             // Обновляем врага с проверкой столкновений
             updateEnemyMovement(enemy);
+            
+            targeting.add(enemy);
         }
     }
+    
+    // Считаем дистанцию и направление к игроку для всех врагов одним проходом
+    targeting.compute(playerPos);
+    targeting.apply();
 }
 
 void GameWorld::updateEnemyMovement(EnemyTank* enemy) {
@@ -1039,8 +1180,7 @@ void GameWorld::handleEnemyCollision(EnemyTank* enemy, Direction moveDir) {
     );
     
     // Пробуем оставшиеся направления пока не найдем валидное
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    std::mt19937& gen = rng;
     std::shuffle(possibleDirections.begin(), possibleDirections.end(), gen);
     
     Point bounds = enemy->getBounds();
@@ -1098,10 +1238,14 @@ void GameWorld::cleanupDestroyedObjects() {
         [](const std::unique_ptr<Explosion>& explosion) {
             return explosion->isDestroyed();
         }), explosions.end());
+
+    // Списки изменились и объекты сдвинулись - перестраиваем и полосы отрисовки
+    rebuildTankList();
 }
 
 void GameWorld::addExplosion(std::unique_ptr<Explosion> explosion) {
     explosions.push_back(std::move(explosion));
+    drawBandAt(explosions.back()->getPosition()).explosions.push_back(explosions.back().get());
 }
 
 const std::vector<std::unique_ptr<Explosion>>& GameWorld::getExplosions() const {
@@ -1154,9 +1298,8 @@ void GameWorld::createLevelObstacles(int level) {
         objects.emplace_back(new Obstacle(Point(fieldWidth - 1, y), ObstacleType::STEEL));
     }
 
-    // Инициализация генератора случайных чисел
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    // Генератор случайных чисел мира
+    std::mt19937& gen = rng;
     std::uniform_real_distribution<> dist(0.0, 1.0);
     std::uniform_int_distribution<> posDist(2, fieldWidth - 3);
     
@@ -1239,7 +1382,7 @@ void GameWorld::createLevelObstacles(int level) {
             iterations++;
             
             // Выбираем случайную активную точку
-            int randomIndex = rand() % activePoints.size();
+            int randomIndex = static_cast<int>(rng() % activePoints.size());
             Point basePoint = activePoints[randomIndex];
             
             // Направления для роста (включая диагонали для более органичной формы)
@@ -1439,8 +1582,8 @@ void GameWorld::createLevelObstacles(int level) {
         for (int x = 3; x < fieldWidth - 3; x += 4 + level/2) {
             for (int y = 3; y < fieldHeight - 3; y += 3) {
                 // Добавляем случайное смещение для органичности
-                int offsetX = (rand() % 3) - 1;
-                int offsetY = (rand() % 3) - 1;
+                int offsetX = static_cast<int>(rng() % 3) - 1;
+                int offsetY = static_cast<int>(rng() % 3) - 1;
                 pathNodes.emplace_back(x + offsetX, y + offsetY);
             }
         }
@@ -1508,3 +1651,301 @@ void GameWorld::triggerDamageFlash() {
 bool GameWorld::isDamageFlashActive() const {
     return damageFlashCounter > 0;
 }
+
+void GameWorld::buildSnapshot(RenderSnapshot& snapshot) const {
+    buildSnapshot(snapshot, 0, 0, fieldWidth, fieldHeight);
+}
+
+void GameWorld::buildSnapshot(RenderSnapshot& snapshot, int left, int top, int width, int height) const {
+    // Окно не выходит за пределы поля
+    width = std::max(1, std::min(width, fieldWidth));
+    height = std::max(1, std::min(height, fieldHeight));
+    left = std::max(0, std::min(left, fieldWidth - width));
+    top = std::max(0, std::min(top, fieldHeight - height));
+
+    snapshot.width = width;
+    snapshot.height = height;
+    snapshot.originX = left;
+    snapshot.originY = top;
+    snapshot.cells.resize(static_cast<size_t>(width) * height);
+
+    // Неподвижный рельеф копируется из кэша только в пределах окна -
+    // стоимость зависит от размера окна, а не карты
+    for (int y = 0; y < height; y++) {
+        const char* row = &terrainLayer[static_cast<size_t>(top + y) * fieldWidth + left];
+        std::copy(row, row + width, &snapshot.cells[static_cast<size_t>(y) * width]);
+    }
+
+    // Клетка окна для точки мира, nullptr если точка не видна
+    auto cellAt = [&](int x, int y) -> char* {
+        x -= left;
+        y -= top;
+        if (x < 0 || x >= width || y < 0 || y >= height) return nullptr;
+        return &snapshot.cells[static_cast<size_t>(y) * width + x];
+    };
+
+    auto drawTank = [&](const DrawnTank& entry) {
+        const Tank* tank = entry.tank;
+        if (tank->isDestroyed()) return;
+        
+        Point pos = tank->getPosition();
+        Point bounds = tank->getBounds();
+        char symbol = tank->getSymbol();
+        
+        for (int y = 0; y < bounds.y; y++) {
+            for (int x = 0; x < bounds.x; x++) {
+                char* cell = cellAt(pos.x + x, pos.y + y);
+                if (cell && (!entry.underTerrain || *cell == ' ')) {
+                    *cell = symbol;
+                }
+            }
+        }
+    };
+
+    // Поверх рисуются только подвижные объекты из полос, которые пересекает окно;
+    // полоса выше окна - для танков, верх которых над окном
+    int firstBand = std::max(0, top / DRAW_BAND_ROWS - 1);
+    int lastBand = std::min(static_cast<int>(drawBands.size()) - 1, (top + height - 1) / DRAW_BAND_ROWS);
+
+    for (const DrawnTank& entry : playerTanks) {
+        drawTank(entry);
+    }
+    for (int band = firstBand; band <= lastBand; band++) {
+        for (const DrawnTank& entry : drawBands[band].tanks) {
+            drawTank(entry);
+        }
+    }
+    
+    for (int band = firstBand; band <= lastBand; band++) {
+        for (const Projectile* proj : drawBands[band].projectiles) {
+            if (proj->isDestroyed()) continue;
+            
+            Point pos = proj->getPosition();
+            if (char* cell = cellAt(pos.x, pos.y)) {
+                *cell = proj->getSymbol();
+            }
+        }
+    }
+    
+    for (int band = firstBand; band <= lastBand; band++) {
+        for (const Bonus* bonus : drawBands[band].bonuses) {
+            if (!bonus->isActive()) continue;
+            
+            Point pos = bonus->getPosition();
+            if (char* cell = cellAt(pos.x, pos.y)) {
+                *cell = bonus->getSymbol();
+            }
+        }
+    }
+
+    for (int band = firstBand; band <= lastBand; band++) {
+        for (const Explosion* explosion : drawBands[band].explosions) {
+            if (explosion->isDestroyed()) continue;
+            
+            Point pos = explosion->getPosition();
+            if (char* cell = cellAt(pos.x, pos.y)) {
+                *cell = explosion->getSymbol();
+            }
+        }
+    }
+
+    snapshot.level = currentLevel;
+    snapshot.hasPlayer = player != nullptr;
+    if (player) {
+        snapshot.score = player->getScore();
+        snapshot.lives = player->getLives();
+        snapshot.health = player->getHealth();
+        snapshot.hasShield = player->getHasShield();
+        snapshot.doubleFire = player->getDoubleFire();
+        snapshot.bonusDuration = player->getBonusDuration();
+    }
+    snapshot.damageFlash = isDamageFlashActive();
+}
+
+const int GameWorld::SAVE_VERSION;
+
+void GameWorld::saveState(std::vector<char>& out) const {
+    BinaryWriter writer(out);
+    writer.writeBytes(SAVE_MAGIC, sizeof(SAVE_MAGIC));
+    writer.writeInt(SAVE_VERSION);
+
+    writer.writeInt(fieldWidth);
+    writer.writeInt(fieldHeight);
+    writer.writeInt(static_cast<int>(state));
+    writer.writeInt(currentLevel);
+    writer.writeInt(enemyCount);
+    writer.writeInt(maxEnemies);
+    writer.writeInt(damageFlashCounter);
+    saveAIParams(writer, aiParams);
+
+    // Состояние генератора - стандартным текстовым представлением mt19937
+    std::ostringstream random;
+    random << rng;
+    writer.writeString(random.str());
+
+    // В списке объектов бывают только танки и препятствия
+    writer.writeInt(static_cast<int>(objects.size()));
+    for (const auto& obj : objects) {
+        const Obstacle* obstacle = dynamic_cast<const Obstacle*>(obj.get());
+        if (obj.get() == player) {
+            writer.writeInt(static_cast<int>(SavedObject::PLAYER));
+        } else if (dynamic_cast<const EnemyTank*>(obj.get())) {
+            writer.writeInt(static_cast<int>(SavedObject::ENEMY));
+        } else if (obstacle) {
+            writer.writeInt(static_cast<int>(SavedObject::OBSTACLE));
+            writer.writeInt(static_cast<int>(obstacle->getType()));
+        }
+        obj->save(writer);
+    }
+
+    writer.writeInt(static_cast<int>(projectiles.size()));
+    for (const auto& projectile : projectiles) {
+        writer.writeInt(indexOf(objects, projectile->getOwner()));
+        projectile->save(writer);
+    }
+
+    writer.writeInt(static_cast<int>(bonuses.size()));
+    for (const auto& bonus : bonuses) {
+        bonus->save(writer);
+    }
+
+    writer.writeInt(static_cast<int>(explosions.size()));
+    for (const auto& explosion : explosions) {
+        explosion->save(writer);
+    }
+
+    // Граф навигации строится дольше, чем весь остальной мир загружается
+    navigation.save(writer);
+
+    const std::vector<DangerMap::Blast>& blasts = danger.getBlasts();
+    writer.writeInt(static_cast<int>(blasts.size()));
+    for (const auto& blast : blasts) {
+        writer.writeInt(blast.center.x);
+        writer.writeInt(blast.center.y);
+        writer.writeInt(blast.ttl);
+    }
+}
+
+bool GameWorld::loadState(const std::vector<char>& data) {
+    BinaryReader reader(data.data(), data.size());
+    if (!reader.expectBytes(SAVE_MAGIC, sizeof(SAVE_MAGIC)) || reader.readInt() != SAVE_VERSION) {
+        return false;
+    }
+
+    // Поле другого размера не подойдёт к сетке местности и камере
+    if (reader.readInt() != fieldWidth || reader.readInt() != fieldHeight) {
+        return false;
+    }
+
+    // Сначала читаем всё во временные объекты: мир меняется только при целом сохранении
+    GameState savedState = static_cast<GameState>(reader.readInt(0, static_cast<int>(GameState::LEVEL_COMPLETE)));
+    int savedLevel = reader.readInt();
+    int savedEnemyCount = reader.readInt();
+    int savedMaxEnemies = reader.readInt();
+    int savedFlash = reader.readInt();
+    AIParams savedParams;
+    loadAIParams(reader, savedParams);
+
+    std::mt19937 savedRng;
+    std::istringstream random(reader.readString());
+    random >> savedRng;
+    if (!random) reader.fail();
+
+    std::vector<std::unique_ptr<GameObject>> savedObjects;
+    PlayerTank* savedPlayer = nullptr;
+    int objectCount = reader.readInt(0, INT_MAX);
+    for (int i = 0; i < objectCount && reader.ok(); i++) {
+        std::unique_ptr<GameObject> obj;
+        switch (static_cast<SavedObject>(reader.readInt(0, static_cast<int>(SavedObject::OBSTACLE)))) {
+            case SavedObject::PLAYER:
+                if (savedPlayer) {
+                    reader.fail();
+                    break;
+                }
+                savedPlayer = new PlayerTank(Point());
+                obj.reset(savedPlayer);
+                break;
+            case SavedObject::ENEMY:
+                obj.reset(new EnemyTank(Point(), AIBehavior::RANDOM, 1));
+                break;
+            case SavedObject::OBSTACLE:
+                obj.reset(new Obstacle(Point(), static_cast<ObstacleType>(
+                    reader.readInt(0, static_cast<int>(ObstacleType::FOREST)))));
+                break;
+        }
+        if (!obj) break;
+        obj->load(reader);
+        savedObjects.push_back(std::move(obj));
+    }
+    if (!savedPlayer) reader.fail();
+
+    std::vector<std::unique_ptr<Projectile>> savedProjectiles;
+    int projectileCount = reader.readInt(0, INT_MAX);
+    for (int i = 0; i < projectileCount && reader.ok(); i++) {
+        int owner = reader.readInt(-1, static_cast<int>(savedObjects.size()) - 1);
+        Tank* ownerTank = owner >= 0 ? dynamic_cast<Tank*>(savedObjects[owner].get()) : nullptr;
+        if (owner >= 0 && !ownerTank) reader.fail();
+
+        std::unique_ptr<Projectile> projectile(new Projectile(Point(), Direction::UP, 0, ownerTank));
+        projectile->load(reader);
+        savedProjectiles.push_back(std::move(projectile));
+    }
+
+    std::vector<std::unique_ptr<Bonus>> savedBonuses;
+    int bonusCount = reader.readInt(0, INT_MAX);
+    for (int i = 0; i < bonusCount && reader.ok(); i++) {
+        std::unique_ptr<Bonus> bonus(new Bonus(Point(), BonusType::SHIELD));
+        bonus->load(reader);
+        savedBonuses.push_back(std::move(bonus));
+    }
+
+    std::vector<std::unique_ptr<Explosion>> savedExplosions;
+    int explosionCount = reader.readInt(0, INT_MAX);
+    for (int i = 0; i < explosionCount && reader.ok(); i++) {
+        std::unique_ptr<Explosion> explosion(new Explosion(Point()));
+        explosion->load(reader);
+        savedExplosions.push_back(std::move(explosion));
+    }
+
+    NavGraph savedNavigation;
+    savedNavigation.load(reader, fieldWidth, fieldHeight);
+
+    std::vector<DangerMap::Blast> savedBlasts;
+    int blastCount = reader.readInt(0, INT_MAX);
+    for (int i = 0; i < blastCount && reader.ok(); i++) {
+        DangerMap::Blast blast;
+        blast.center.x = reader.readInt();
+        blast.center.y = reader.readInt();
+        blast.ttl = reader.readInt(1, DangerMap::BLAST_LIFETIME);
+        savedBlasts.push_back(blast);
+    }
+
+    if (!reader.ok() || !reader.atEnd()) {
+        return false;
+    }
+
+    // Всё прочитано - подменяем мир; старые объекты удалятся вместе с временными списками
+    objects.swap(savedObjects);
+    projectiles.swap(savedProjectiles);
+    bonuses.swap(savedBonuses);
+    explosions.swap(savedExplosions);
+    player = savedPlayer;
+    state = savedState;
+    currentLevel = savedLevel;
+    enemyCount = savedEnemyCount;
+    maxEnemies = savedMaxEnemies;
+    damageFlashCounter = savedFlash;
+    aiParams = savedParams;
+    rng = savedRng;
+    navigation = std::move(savedNavigation);
+
+    // Местность и список танков выводятся из объектов
+    buildTerrain();
+    danger.reset(terrain);
+    rebuildTankList();
+    for (const auto& blast : savedBlasts) {
+        danger.addBlast(blast.center, blast.ttl);
+    }
+    return true;
+}
+
@@ -23,6 +23,12 @@
 #include "Bonus.h"
 #include "Projectile.h"
 #include "Explosion.h"
+#include "EnemyTargeting.h"
+#include "TerrainGrid.h"
+#include "DangerMap.h"
+#include "NavGraph.h"
+#include "AIParams.h"
+#include "RenderSnapshot.h"
 
 /**
  * @brief Enumeration representing possible game states.
@@ -49,6 +55,36 @@ private:
     int enemyCount;                 ///< Current number of enemies
     int maxEnemies;                 ///< Maximum enemies for current level
     int damageFlashCounter;         ///< Counter for damage flash effect
+    EnemyTargeting targeting;       ///< Batch targeting state for enemies
+    TerrainGrid terrain;            ///< Grid of static obstacles
+    DangerMap danger;               ///< Player firing lines and recent explosions
+    NavGraph navigation;            ///< Hierarchical pathfinding graph over terrain
+    std::mt19937 rng;               ///< Random generator for level generation, bonuses and AI
+    AIParams aiParams;              ///< Parameters shared by all enemies
+    std::vector<char> terrainLayer; ///< Obstacle symbols per cell, base layer of render snapshots
+
+    /**
+     * @brief Tank entry of the snapshot draw list.
+     */
+    struct DrawnTank {
+        Tank* tank;         ///< Tank from objects
+        bool underTerrain;  ///< Obstacles follow the tank in objects, so forest covers it
+    };
+    std::vector<DrawnTank> tanks;   ///< Player and enemy tanks in objects order
+
+    static const int DRAW_BAND_ROWS = 8;    ///< Rows per draw band, more than any object is tall
+
+    /**
+     * @brief Moving objects whose top row lies in one band of DRAW_BAND_ROWS rows.
+     */
+    struct DrawBand {
+        std::vector<DrawnTank> tanks;                   ///< Enemy tanks in objects order
+        std::vector<const Projectile*> projectiles;     ///< Projectiles
+        std::vector<const Bonus*> bonuses;              ///< Bonuses
+        std::vector<const Explosion*> explosions;       ///< Explosions
+    };
+    std::vector<DrawBand> drawBands;    ///< Moving objects by row band, so snapshots visit only the window
+    std::vector<DrawnTank> playerTanks; ///< Player entry of tanks; the player moves between band rebuilds
 
     /**
      * @brief Structure containing difficulty parameters for level generation.
@@ -75,6 +111,12 @@ private:
     void handleTankObstacleCollision(Tank* tank); ///< Handles tank-obstacle collision
     bool handleProjectileHit(GameObject* target, Projectile* projectile, int damage); ///< Handles projectile hit
     void applySlowToEnemies(int duration); ///< Applies slow effect to all enemies
+    void spawnExplosion(const Point& pos); ///< Creates explosion and marks its danger area
+    void onObstacleDestroyed(const Obstacle* obstacle); ///< Updates terrain after obstacle destruction
+    void rebuildTankList();                ///< Collects tanks from objects after the list changes
+    void indexDrawables();                 ///< Sorts moving objects into draw bands by position
+    DrawBand& drawBandAt(const Point& pos); ///< Band holding objects whose top row is pos.y
+    void buildTerrain();                   ///< Fills terrain grid and terrain layer from obstacles
     
     DifficultyParams adjustDifficulty(int level); ///< Adjusts difficulty based on level
     bool isValidPosition(const Point& pos, const Point& bounds, const GameObject* excludeObj = nullptr) const; ///< Checks if position is valid
@@ -87,6 +129,8 @@ private:
     void checkGameConditions();            ///< Checks win/lose conditions
 
 public:
+    static const int SAVE_VERSION = 2;  ///< Version of the saveState format; older saves are rejected
+
     /**
      * @brief Constructs a GameWorld object.
      * @param width Width of game field.
@@ -108,6 +152,54 @@ public:
      */
     void loadLevel(int level);
     
+    /**
+     * @brief Rebuilds terrain grid, danger map and navigation from current obstacles.
+     * 
+     * Must be called after the obstacle set is replaced (level load, map load).
+     * @returns None
+     */
+    void refreshTerrain();
+    
+    /**
+     * @brief Gets terrain grid of the level.
+     * @return Const reference to terrain grid.
+     */
+    const TerrainGrid& getTerrain() const;
+    
+    /**
+     * @brief Gets navigation graph of the level.
+     * @return Const reference to navigation graph.
+     */
+    const NavGraph& getNavigation() const;
+    
+    /**
+     * @brief Reseeds random generator of the world.
+     * 
+     * Call before loadLevel to make level generation and AI reproducible.
+     * @param seed Seed value.
+     * @returns None
+     */
+    void setSeed(unsigned int seed);
+    
+    /**
+     * @brief Sets AI parameters used by all enemies.
+     * @param params AI parameters.
+     * @returns None
+     */
+    void setAIParams(const AIParams& params);
+    
+    /**
+     * @brief Gets AI parameters used by all enemies.
+     * @return Const reference to AI parameters.
+     */
+    const AIParams& getAIParams() const;
+    
+    /**
+     * @brief Gets danger map of the level.
+     * @return Const reference to danger map.
+     */
+    const DangerMap& getDangerMap() const;
+    
     /**
      * @brief Checks all types of collisions.
      * @returns None
@@ -275,6 +367,54 @@ public:
      * @return true if damage flash is active, false otherwise.
      */
     bool isDamageFlashActive() const;
+
+    /**
+     * @brief Copies field symbols and HUD values into a render snapshot.
+     * 
+     * Starts from the cached terrain layer and draws only tanks, projectiles,
+     * bonuses and explosions over it, so obstacles are not walked every frame.
+     * Reuses storage of the snapshot, so repeated calls do not allocate.
+     * @param snapshot Snapshot to fill.
+     * @returns None
+     */
+    void buildSnapshot(RenderSnapshot& snapshot) const;
+
+    /**
+     * @brief Copies a window of the field and HUD values into a render snapshot.
+     * 
+     * Only terrain rows inside the window are copied, so the cost does not
+     * grow with the map. The window is clamped to the field.
+     * @param snapshot Snapshot to fill.
+     * @param left Leftmost field column of the window.
+     * @param top Topmost field row of the window.
+     * @param width Window width in cells.
+     * @param height Window height in cells.
+     * @returns None
+     */
+    void buildSnapshot(RenderSnapshot& snapshot, int left, int top, int width, int height) const;
+
+    /**
+     * @brief Writes the whole world state in a versioned binary format.
+     * 
+     * Covers objects with their timers, projectiles with their owners,
+     * bonuses, explosions, danger areas, the navigation graph, the random
+     * generator, AI parameters and level. Terrain and the tank list are
+     * derived from the objects and rebuilt on load.
+     * @param out Buffer the state is appended to.
+     * @returns None
+     */
+    void saveState(std::vector<char>& out) const;
+
+    /**
+     * @brief Restores world state written by saveState().
+     * 
+     * The data is checked completely before anything changes, so damaged
+     * data, another format version or another field size leave the world
+     * as it was.
+     * @param data Saved state.
+     * @return true if the state was restored.
+     */
+    bool loadState(const std::vector<char>& data);
 };
 
 #endif // GAMEWORLD_H
@@ -0,0 +1,471 @@
+/**
+ * @file NavGraph.cpp
+ * @author Vld251
+ * @brief Implementation of the hierarchical navigation graph.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "NavGraph.h"
+#include "BinaryStream.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+
+namespace {
+
+// Смещения по направлениям в порядке Direction: UP, DOWN, LEFT, RIGHT
+const int DX[4] = {0, 0, -1, 1};
+const int DY[4] = {-1, 1, 0, 0};
+
+Direction opposite(Direction dir) {
+    switch (dir) {
+        case Direction::UP: return Direction::DOWN;
+        case Direction::DOWN: return Direction::UP;
+        case Direction::LEFT: return Direction::RIGHT;
+        default: return Direction::LEFT;
+    }
+}
+
+Point neighbour(const Point& pos, int dir) {
+    return Point(pos.x + DX[dir], pos.y + DY[dir]);
+}
+
+}
+
+const int NavGraph::CLUSTER_SIZE;
+const int NavGraph::LONG_ENTRANCE;
+
+NavGraph::NavGraph() : width(0), height(0), clustersX(0), clustersY(0), revision(1) {}
+
+void NavGraph::build(const TerrainGrid& terrain) {
+    width = terrain.getWidth();
+    height = terrain.getHeight();
+    clustersX = (width + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    clustersY = (height + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    clusters.assign(static_cast<size_t>(clustersX) * clustersY, Cluster());
+
+    // Каждая граница сканируется один раз - со стороны левого/верхнего кластера
+    for (int c = 0; c < static_cast<int>(clusters.size()); c++) {
+        scanBorder(c, Direction::RIGHT, terrain);
+        scanBorder(c, Direction::DOWN, terrain);
+    }
+
+    for (int c = 0; c < static_cast<int>(clusters.size()); c++) {
+        linkCluster(c, terrain);
+    }
+    revision++;
+}
+
+void NavGraph::updateCell(const Point& pos, const TerrainGrid& terrain) {
+    if (pos.x < 0 || pos.x >= width || pos.y < 0 || pos.y >= height) return;
+
+    int cluster = clusterOf(pos);
+    Point origin = clusterOrigin(cluster);
+    Point size = clusterSize(cluster);
+
+    // Клетка на краю кластера меняет входы общей с соседом границы
+    bool onSide[4] = {
+        pos.y == origin.y,
+        pos.y == origin.y + size.y - 1,
+        pos.x == origin.x,
+        pos.x == origin.x + size.x - 1
+    };
+
+    for (int s = 0; s < 4; s++) {
+        Direction side = static_cast<Direction>(s);
+        int other = neighbourCluster(cluster, side);
+        if (!onSide[s] || other < 0) continue;
+
+        dropSide(cluster, side);
+        dropSide(other, opposite(side));
+        scanBorder(cluster, side, terrain);
+        linkCluster(other, terrain);
+    }
+
+    linkCluster(cluster, terrain);
+    revision++;
+}
+
+bool NavGraph::nextStep(const Point& from, const Point& to, const TerrainGrid& terrain,
+                        Direction& result) const {
+    std::vector<Point> route;
+    return followRoute(from, to, route, terrain, result) ||
+           (findRoute(from, to, terrain, route) && followRoute(from, to, route, terrain, result));
+}
+
+bool NavGraph::findRoute(const Point& from, const Point& to, const TerrainGrid& terrain,
+                         std::vector<Point>& route) const {
+    route.clear();
+    if (clusters.empty() || from == to) return false;
+    if (!terrain.inBounds(from) || !terrain.inBounds(to)) return false;
+
+    int startCluster = clusterOf(from);
+    int goalCluster = clusterOf(to);
+
+    std::vector<int> startDist;
+    std::vector<int> goalDist;
+    localDistances(startCluster, from, terrain, startDist);
+    localDistances(goalCluster, to, terrain, goalDist);
+
+    const int START = -2;
+    const int GOAL = -1;
+
+    auto keyOf = [this](const Point& p) { return p.y * width + p.x; };
+    auto heuristic = [&to](const Point& p) { return std::abs(p.x - to.x) + std::abs(p.y - to.y); };
+    auto localIndex = [this](int cluster, const Point& p) {
+        Point origin = clusterOrigin(cluster);
+        return (p.y - origin.y) * clusterSize(cluster).x + (p.x - origin.x);
+    };
+
+    // Открытый список: (f, ключ узла), ключ - индекс клетки на карте
+    typedef std::pair<int, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    std::unordered_map<int, int> cost;
+    std::unordered_map<int, int> parent;
+
+    auto relax = [&](int key, int g, int h, int prev) {
+        auto it = cost.find(key);
+        if (it != cost.end() && it->second <= g) return;
+        cost[key] = g;
+        parent[key] = prev;
+        open.push(Entry(g + h, key));
+    };
+
+    for (const Node& node : clusters[startCluster].nodes) {
+        int d = startDist[localIndex(startCluster, node.pos)];
+        if (d >= 0) relax(keyOf(node.pos), d, heuristic(node.pos), START);
+    }
+
+    bool found = false;
+    while (!open.empty()) {
+        Entry entry = open.top();
+        open.pop();
+
+        if (entry.second == GOAL) {
+            found = true;
+            break;
+        }
+
+        Point pos(entry.second % width, entry.second / width);
+        int g = cost[entry.second];
+        if (g + heuristic(pos) < entry.first) continue; // устаревшая запись
+
+        int cluster = clusterOf(pos);
+        int index = findNode(cluster, pos);
+        const Cluster& current = clusters[cluster];
+        int count = static_cast<int>(current.nodes.size());
+
+        if (cluster == goalCluster) {
+            int d = goalDist[localIndex(goalCluster, pos)];
+            if (d >= 0) relax(GOAL, g + d, 0, entry.second);
+        }
+
+        // Переходы внутри кластера по предрассчитанным расстояниям
+        for (int j = 0; j < count; j++) {
+            int d = current.dist[index * count + j];
+            if (j == index || d < 0) continue;
+            const Point& next = current.nodes[j].pos;
+            relax(keyOf(next), g + d, heuristic(next), entry.second);
+        }
+
+        // Переход через границу в парный вход соседнего кластера
+        for (int s = 0; s < 4; s++) {
+            if (!(current.nodes[index].sides & (1 << s))) continue;
+            int other = neighbourCluster(cluster, static_cast<Direction>(s));
+            Point next = neighbour(pos, s);
+            if (other >= 0 && findNode(other, next) >= 0) {
+                relax(keyOf(next), g + 1, heuristic(next), entry.second);
+            }
+        }
+    }
+
+    if (!found) return false;
+
+    // Восстанавливаем цепочку входов от старта к цели
+    for (int key = parent[GOAL]; key != START; key = parent[key]) {
+        route.push_back(Point(key % width, key / width));
+    }
+    std::reverse(route.begin(), route.end());
+    return !route.empty();
+}
+
+bool NavGraph::followRoute(const Point& from, const Point& to, const std::vector<Point>& route,
+                           const TerrainGrid& terrain, Direction& result) const {
+    if (clusters.empty() || from == to) return false;
+    if (!terrain.inBounds(from) || !terrain.inBounds(to)) return false;
+
+    int cluster = clusterOf(from);
+
+    // Цель в том же кластере и достижима внутри него - маршрут не нужен
+    if (cluster == clusterOf(to) && stepTowards(cluster, from, to, terrain, result)) {
+        return true;
+    }
+
+    // Первый вход маршрута в этом кластере, за которым маршрут его покидает
+    size_t exit = 0;
+    while (exit < route.size() &&
+           (clusterOf(route[exit]) != cluster ||
+            (exit + 1 < route.size() && clusterOf(route[exit + 1]) == cluster))) {
+        exit++;
+    }
+    // Маршрут не проходит здесь или кончается в кластере цели, недостижимой внутри него
+    if (exit + 1 >= route.size()) return false;
+
+    if (route[exit] != from) {
+        return stepTowards(cluster, from, route[exit], terrain, result);
+    }
+
+    // Стоим на выходе - шагаем через границу в парный вход соседнего кластера
+    for (int s = 0; s < 4; s++) {
+        if (neighbour(from, s) == route[exit + 1]) {
+            result = static_cast<Direction>(s);
+            return true;
+        }
+    }
+    return false;
+}
+
+int NavGraph::getNodeCount() const {
+    int count = 0;
+    for (const Cluster& cluster : clusters) {
+        count += static_cast<int>(cluster.nodes.size());
+    }
+    return count;
+}
+
+int NavGraph::getCluster(const Point& pos) const {
+    return clusterOf(pos);
+}
+
+unsigned int NavGraph::getRevision() const {
+    return revision;
+}
+
+// Приватные методы
+
+int NavGraph::clusterOf(const Point& pos) const {
+    return (pos.y / CLUSTER_SIZE) * clustersX + pos.x / CLUSTER_SIZE;
+}
+
+Point NavGraph::clusterOrigin(int cluster) const {
+    return Point((cluster % clustersX) * CLUSTER_SIZE, (cluster / clustersX) * CLUSTER_SIZE);
+}
+
+Point NavGraph::clusterSize(int cluster) const {
+    Point origin = clusterOrigin(cluster);
+    return Point(std::min(CLUSTER_SIZE, width - origin.x), std::min(CLUSTER_SIZE, height - origin.y));
+}
+
+int NavGraph::neighbourCluster(int cluster, Direction side) const {
+    int cx = cluster % clustersX + DX[static_cast<int>(side)];
+    int cy = cluster / clustersX + DY[static_cast<int>(side)];
+    if (cx < 0 || cx >= clustersX || cy < 0 || cy >= clustersY) return -1;
+    return cy * clustersX + cx;
+}
+
+int NavGraph::findNode(int cluster, const Point& pos) const {
+    const std::vector<Node>& nodes = clusters[cluster].nodes;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].pos == pos) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void NavGraph::addNode(int cluster, const Point& pos, Direction side) {
+    int index = findNode(cluster, pos);
+    if (index >= 0) {
+        // Угловая клетка может быть входом сразу на двух сторонах
+        clusters[cluster].nodes[index].sides |= 1 << static_cast<int>(side);
+        return;
+    }
+
+    Node node;
+    node.pos = pos;
+    node.sides = 1 << static_cast<int>(side);
+    clusters[cluster].nodes.push_back(node);
+}
+
+void NavGraph::dropSide(int cluster, Direction side) {
+    std::vector<Node>& nodes = clusters[cluster].nodes;
+    int mask = ~(1 << static_cast<int>(side));
+
+    for (Node& node : nodes) {
+        node.sides &= mask;
+    }
+    nodes.erase(std::remove_if(nodes.begin(), nodes.end(),
+        [](const Node& node) { return node.sides == 0; }), nodes.end());
+}
+
+void NavGraph::scanBorder(int cluster, Direction side, const TerrainGrid& terrain) {
+    int other = neighbourCluster(cluster, side);
+    if (other < 0) return;
+
+    Point origin = clusterOrigin(cluster);
+    Point size = clusterSize(cluster);
+    int s = static_cast<int>(side);
+
+    // Первая клетка стороны и шаг вдоль неё
+    bool horizontal = (side == Direction::UP || side == Direction::DOWN);
+    Point start = origin;
+    if (side == Direction::DOWN) start.y += size.y - 1;
+    if (side == Direction::RIGHT) start.x += size.x - 1;
+    int stepX = horizontal ? 1 : 0;
+    int stepY = horizontal ? 0 : 1;
+    int length = horizontal ? size.x : size.y;
+
+    int runStart = -1;
+    for (int i = 0; i <= length; i++) {
+        bool open = false;
+        if (i < length) {
+            Point inner(start.x + stepX * i, start.y + stepY * i);
+            open = !terrain.blocksTanks(inner) && !terrain.blocksTanks(neighbour(inner, s));
+        }
+
+        if (open && runStart < 0) {
+            runStart = i;
+        } else if (!open && runStart >= 0) {
+            // Широкий проход получает вход с каждого края, узкий - один посередине
+            int runEnd = i - 1;
+            int picks[2] = { (runStart + runEnd) / 2, -1 };
+            if (runEnd - runStart + 1 >= LONG_ENTRANCE) {
+                picks[0] = runStart;
+                picks[1] = runEnd;
+            }
+
+            for (int k : picks) {
+                if (k < 0) continue;
+                Point inner(start.x + stepX * k, start.y + stepY * k);
+                addNode(cluster, inner, side);
+                addNode(other, neighbour(inner, s), opposite(side));
+            }
+            runStart = -1;
+        }
+    }
+}
+
+void NavGraph::linkCluster(int cluster, const TerrainGrid& terrain) {
+    Cluster& current = clusters[cluster];
+    Point origin = clusterOrigin(cluster);
+    int sizeX = clusterSize(cluster).x;
+    int count = static_cast<int>(current.nodes.size());
+
+    current.dist.assign(static_cast<size_t>(count) * count, -1);
+
+    std::vector<int> local;
+    for (int i = 0; i < count; i++) {
+        localDistances(cluster, current.nodes[i].pos, terrain, local);
+        for (int j = 0; j < count; j++) {
+            const Point& p = current.nodes[j].pos;
+            current.dist[i * count + j] = local[(p.y - origin.y) * sizeX + (p.x - origin.x)];
+        }
+    }
+}
+
+void NavGraph::localDistances(int cluster, const Point& from, const TerrainGrid& terrain,
+                              std::vector<int>& out) const {
+    Point origin = clusterOrigin(cluster);
+    Point size = clusterSize(cluster);
+    out.assign(static_cast<size_t>(size.x) * size.y, -1);
+
+    std::vector<Point> queue;
+    queue.reserve(out.size());
+    queue.push_back(from);
+    out[(from.y - origin.y) * size.x + (from.x - origin.x)] = 0;
+
+    // Поиск в ширину, не выходящий за пределы кластера
+    for (size_t head = 0; head < queue.size(); head++) {
+        Point p = queue[head];
+        int d = out[(p.y - origin.y) * size.x + (p.x - origin.x)];
+
+        for (int s = 0; s < 4; s++) {
+            Point q = neighbour(p, s);
+            if (q.x < origin.x || q.x >= origin.x + size.x ||
+                q.y < origin.y || q.y >= origin.y + size.y) continue;
+
+            int idx = (q.y - origin.y) * size.x + (q.x - origin.x);
+            if (out[idx] >= 0 || terrain.blocksTanks(q)) continue;
+
+            out[idx] = d + 1;
+            queue.push_back(q);
+        }
+    }
+}
+
+bool NavGraph::stepTowards(int cluster, const Point& from, const Point& to, const TerrainGrid& terrain,
+                           Direction& result) const {
+    if (from == to) return false;
+
+    std::vector<int> dist;
+    localDistances(cluster, to, terrain, dist);
+
+    Point origin = clusterOrigin(cluster);
+    Point size = clusterSize(cluster);
+    int here = dist[(from.y - origin.y) * size.x + (from.x - origin.x)];
+    if (here < 0) return false;
+
+    // Шагаем в соседнюю клетку, которая на единицу ближе к цели
+    for (int s = 0; s < 4; s++) {
+        Point q = neighbour(from, s);
+        if (q.x < origin.x || q.x >= origin.x + size.x ||
+            q.y < origin.y || q.y >= origin.y + size.y) continue;
+
+        if (dist[(q.y - origin.y) * size.x + (q.x - origin.x)] == here - 1) {
+            result = static_cast<Direction>(s);
+            return true;
+        }
+    }
+    return false;
+}
+
+void NavGraph::save(BinaryWriter& out) const {
+    // Размер карты известен миру; кластеры идут в том же порядке, что и в build().
+    // Ревизия сохраняется: маршруты, сохранённые танками, остаются годными
+    out.writeInt(static_cast<int>(revision));
+    for (const Cluster& cluster : clusters) {
+        out.writeInt(static_cast<int>(cluster.nodes.size()));
+        for (const Node& node : cluster.nodes) {
+            out.writeInt(node.pos.x);
+            out.writeInt(node.pos.y);
+            out.writeInt(node.sides);
+        }
+        for (int d : cluster.dist) {
+            out.writeInt(d);
+        }
+    }
+}
+
+void NavGraph::load(BinaryReader& in, int mapWidth, int mapHeight) {
+    width = mapWidth;
+    height = mapHeight;
+    clustersX = (width + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    clustersY = (height + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    clusters.assign(static_cast<size_t>(clustersX) * clustersY, Cluster());
+    revision = static_cast<unsigned int>(in.readInt(1, INT_MAX));
+
+    // Входы лежат на периметре кластера; узел вне кластера сломал бы поиск пути
+    for (int c = 0; c < static_cast<int>(clusters.size()) && in.ok(); c++) {
+        Cluster& cluster = clusters[c];
+        Point origin = clusterOrigin(c);
+        Point size = clusterSize(c);
+        int count = in.readInt(0, 4 * CLUSTER_SIZE);
+
+        cluster.nodes.resize(count);
+        for (Node& node : cluster.nodes) {
+            node.pos.x = in.readInt(origin.x, origin.x + size.x - 1);
+            node.pos.y = in.readInt(origin.y, origin.y + size.y - 1);
+            node.sides = in.readInt(0, 15);
+        }
+        cluster.dist.resize(static_cast<size_t>(count) * count);
+        for (int& d : cluster.dist) {
+            d = in.readInt(-1, size.x * size.y);
+        }
+    }
+}
+
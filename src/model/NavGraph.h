@@ -0,0 +1,173 @@
+/**
+ * @file NavGraph.h
+ * @author Vld251
+ * @brief Hierarchical navigation graph over the terrain grid for enemy pathfinding.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef NAVGRAPH_H
+#define NAVGRAPH_H
+
+#include "GameObject.h"
+#include "TerrainGrid.h"
+#include <vector>
+
+/**
+ * @brief Cluster-based abstract graph for path queries on large maps.
+ * 
+ * The terrain is split into square clusters. Passable openings between
+ * neighbouring clusters become entrance nodes, and distances between the
+ * entrances of one cluster are precomputed. A query searches this small
+ * graph and refines only inside the cluster of the querying tank. When a
+ * cell changes, only its cluster (and the borders it shares) is rebuilt.
+ */
+class NavGraph {
+private:
+    /**
+     * @brief Entrance cell of a cluster.
+     */
+    struct Node {
+        Point pos;          ///< Cell of the entrance
+        int sides;          ///< Bit mask of cluster sides the entrance lies on (bit = Direction)
+    };
+
+    /**
+     * @brief Entrances of one cluster and distances between them.
+     */
+    struct Cluster {
+        std::vector<Node> nodes;    ///< Entrance nodes
+        std::vector<int> dist;      ///< Pairwise distances inside cluster (n*n, -1 if unreachable)
+    };
+
+    int width;                      ///< Map width in cells
+    int height;                     ///< Map height in cells
+    int clustersX;                  ///< Clusters per row
+    int clustersY;                  ///< Clusters per column
+    std::vector<Cluster> clusters;  ///< All clusters, row-major
+    unsigned int revision;          ///< Bumped on every change of the graph
+
+    int clusterOf(const Point& pos) const;                          ///< Cluster index of cell
+    Point clusterOrigin(int cluster) const;                         ///< Top-left cell of cluster
+    Point clusterSize(int cluster) const;                           ///< Width and height of cluster
+    int neighbourCluster(int cluster, Direction side) const;        ///< Adjacent cluster or -1
+    int findNode(int cluster, const Point& pos) const;              ///< Node index or -1
+    void addNode(int cluster, const Point& pos, Direction side);    ///< Adds or tags entrance node
+    void dropSide(int cluster, Direction side);                     ///< Removes entrances of one side
+    void scanBorder(int cluster, Direction side, const TerrainGrid& terrain); ///< Finds entrances on a side
+    void linkCluster(int cluster, const TerrainGrid& terrain);      ///< Recomputes intra-cluster distances
+    void localDistances(int cluster, const Point& from, const TerrainGrid& terrain,
+                        std::vector<int>& out) const;               ///< BFS limited to cluster
+    bool stepTowards(int cluster, const Point& from, const Point& to, const TerrainGrid& terrain,
+                     Direction& result) const;                      ///< First step of local path
+
+public:
+    static const int CLUSTER_SIZE = 10;     ///< Cluster side in cells
+    static const int LONG_ENTRANCE = 6;     ///< Openings this wide get an entrance at each end
+
+    /**
+     * @brief Constructs an empty graph.
+     * @returns None
+     */
+    NavGraph();
+
+    /**
+     * @brief Builds graph for whole terrain.
+     * @param terrain Terrain of the level.
+     * @returns None
+     */
+    void build(const TerrainGrid& terrain);
+
+    /**
+     * @brief Rebuilds the cluster containing a changed cell.
+     * @param pos Changed cell.
+     * @param terrain Current terrain.
+     * @returns None
+     */
+    void updateCell(const Point& pos, const TerrainGrid& terrain);
+
+    /**
+     * @brief Finds direction of the first step of a path.
+     * @param from Start cell.
+     * @param to Target cell.
+     * @param terrain Current terrain.
+     * @param result First step direction.
+     * @return true if a path exists, false otherwise.
+     */
+    bool nextStep(const Point& from, const Point& to, const TerrainGrid& terrain,
+                  Direction& result) const;
+
+    /**
+     * @brief Searches the abstract graph for the entrances a path passes.
+     * 
+     * A route stays usable while the graph revision is unchanged and the
+     * target stays in its cluster, so callers can keep it and refine only
+     * the leg inside the current cluster with followRoute().
+     * @param from Start cell.
+     * @param to Target cell.
+     * @param terrain Current terrain.
+     * @param route Entrance cells from start to target.
+     * @return true if a path exists, false otherwise.
+     */
+    bool findRoute(const Point& from, const Point& to, const TerrainGrid& terrain,
+                   std::vector<Point>& route) const;
+
+    /**
+     * @brief Finds direction of the first step along a route found earlier.
+     * 
+     * Searches only inside the cluster of the start cell.
+     * @param from Start cell.
+     * @param to Target cell.
+     * @param route Route from findRoute(), possibly for an earlier start cell.
+     * @param terrain Current terrain.
+     * @param result First step direction.
+     * @return true if a step was found, false if the route does not lead on from here.
+     */
+    bool followRoute(const Point& from, const Point& to, const std::vector<Point>& route,
+                     const TerrainGrid& terrain, Direction& result) const;
+
+    /**
+     * @brief Gets cluster of a cell.
+     * @param pos Cell inside the map.
+     * @return Cluster index.
+     */
+    int getCluster(const Point& pos) const;
+
+    /**
+     * @brief Gets number of entrance nodes in the graph.
+     * @return Node count.
+     */
+    int getNodeCount() const;
+
+    /**
+     * @brief Gets revision of the graph.
+     * 
+     * The revision changes whenever the graph is built or updated, so paths
+     * cached by callers can be checked against it. Saves keep the revision.
+     * @return Current revision, starting from 1.
+     */
+    unsigned int getRevision() const;
+
+    /**
+     * @brief Writes the graph and its revision, so a restored game does not have to rebuild it.
+     * @param out Output buffer.
+     * @returns None
+     */
+    void save(BinaryWriter& out) const;
+
+    /**
+     * @brief Restores a graph written by save() for a map of the given size.
+     * 
+     * Errors are reported through the reader.
+     * @param in Input buffer.
+     * @param mapWidth Map width in cells.
+     * @param mapHeight Map height in cells.
+     * @returns None
+     */
+    void load(BinaryReader& in, int mapWidth, int mapHeight);
+};
+
+#endif // NAVGRAPH_H
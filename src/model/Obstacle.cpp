@@ -10,6 +10,7 @@
  */
 
 #include "Obstacle.h"
+#include "BinaryStream.h"
 
 Obstacle::Obstacle(Point pos, ObstacleType obsType, bool movable)
     : GameObject(pos, Direction::UP, 0, 1, false), 
@@ -135,3 +136,14 @@ char Water::getSymbol() const { return '~'; }
 Forest::Forest(Point pos) : Obstacle(pos, ObstacleType::FOREST, false) {}
 
 char Forest::getSymbol() const { return '*'; }
+
+void Obstacle::save(BinaryWriter& out) const {
+    // Тип записывает мир: от него зависит, какой класс создать при загрузке
+    GameObject::save(out);
+    out.writeBool(movable);
+}
+
+void Obstacle::load(BinaryReader& in) {
+    GameObject::load(in);
+    movable = in.readBool();
+}
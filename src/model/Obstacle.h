@@ -106,6 +106,9 @@ public:
      * @returns None
      */
     void takeDamage(int damage) override;
+
+    void save(BinaryWriter& out) const override;
+    void load(BinaryReader& in) override;
 };
 
 /**
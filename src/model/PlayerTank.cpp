@@ -10,6 +10,7 @@
  */
 
 #include "PlayerTank.h"
+#include "BinaryStream.h"
 
 PlayerTank::PlayerTank(Point pos): Tank(pos, Direction::UP, 1, 3, 2), lives(3), score(0) {
     setReloadTime(1);
@@ -122,3 +123,15 @@ Projectile* PlayerTank::fire() {
     
     return firstShot;
 }
+
+void PlayerTank::save(BinaryWriter& out) const {
+    Tank::save(out);
+    out.writeInt(lives);
+    out.writeInt(score);
+}
+
+void PlayerTank::load(BinaryReader& in) {
+    Tank::load(in);
+    lives = in.readInt();
+    score = in.readInt();
+}
@@ -108,6 +108,9 @@ public:
      * @return Pointer to created projectile, or nullptr if cannot fire.
      */
     Projectile* fire() override;
+
+    void save(BinaryWriter& out) const override;
+    void load(BinaryReader& in) override;
 };
 
 #endif // PLAYERTANK_H
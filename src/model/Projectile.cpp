@@ -11,6 +11,7 @@
 
 #include "Projectile.h"
 #include "Tank.h"
+#include "BinaryStream.h"
 
 Projectile::Projectile(Point pos, Direction dir, int dmg, Tank* ownerTank)
     : GameObject(pos, dir, 0, 1, true), damage(dmg), owner(ownerTank), processed(false) {}
@@ -86,3 +87,20 @@ std::vector<Point> Projectile::getTrajectory(int maxRange) const {
 void Projectile::setDamage(int newDamage) {
     damage = newDamage;
 }
+
+void Projectile::setOwner(Tank* ownerTank) {
+    owner = ownerTank;
+}
+
+void Projectile::save(BinaryWriter& out) const {
+    // Владельца записывает мир - номером танка в списке объектов
+    GameObject::save(out);
+    out.writeInt(damage);
+    out.writeBool(processed);
+}
+
+void Projectile::load(BinaryReader& in) {
+    GameObject::load(in);
+    damage = in.readInt();
+    processed = in.readBool();
+}
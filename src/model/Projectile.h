@@ -70,6 +70,13 @@ public:
      * @returns None
      */
     void setDamage(int newDamage);
+
+    /**
+     * @brief Sets tank that fired this projectile.
+     * @param ownerTank Owner tank, or nullptr.
+     * @returns None
+     */
+    void setOwner(Tank* ownerTank);
     
     /**
      * @brief Updates projectile state (travels and self-destructs).
@@ -95,6 +102,9 @@ public:
      * @return Vector of points along trajectory.
      */
     std::vector<Point> getTrajectory(int maxRange = 20) const;
+
+    void save(BinaryWriter& out) const override;
+    void load(BinaryReader& in) override;
 };
 
 #endif // PROJECTILE_H
@@ -0,0 +1,54 @@
+/**
+ * @file RenderSnapshot.h
+ * @author Vld251
+ * @brief Compact copy of everything the renderer needs to draw one game frame.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include <chrono>
+#include <vector>
+
+/**
+ * @brief Field cells and HUD values of one tick.
+ * 
+ * Filled by GameWorld on the game thread and read by the renderer, so the
+ * renderer never touches live game objects.
+ */
+struct RenderSnapshot {
+    int width;                 ///< Visible window width in cells
+    int height;                ///< Visible window height in cells
+    int originX;               ///< Field column of the window's left edge
+    int originY;               ///< Field row of the window's top edge
+    std::vector<char> cells;   ///< Symbols of the visible window, row by row
+    bool hasPlayer;            ///< Whether HUD values below are valid
+    int level;                 ///< Current level number
+    int score;                 ///< Player score
+    int lives;                 ///< Player lives
+    int health;                ///< Player health
+    bool hasShield;            ///< Player shield bonus
+    bool doubleFire;           ///< Player double fire bonus
+    int bonusDuration;         ///< Turns left for player bonuses
+    bool damageFlash;          ///< Whether damage flash is active
+    bool hasInput;             ///< Frame is the first to show the effect of a key press
+    std::chrono::steady_clock::time_point inputTime;    ///< When the oldest key applied in this frame was read
+    std::chrono::steady_clock::time_point publishTime;  ///< When the frame was published, set by the render thread
+    unsigned long sequence;    ///< Publication number, assigned by the render thread
+
+    /**
+     * @brief Constructs an empty snapshot.
+     * @returns None
+     */
+    RenderSnapshot()
+        : width(0), height(0), originX(0), originY(0), hasPlayer(false), level(0), score(0), lives(0),
+          health(0), hasShield(false), doubleFire(false), bonusDuration(0),
+          damageFlash(false), hasInput(false), sequence(0) {}
+};
+
+#endif // RENDERSNAPSHOT_H
@@ -10,6 +10,7 @@
  */
 
 #include "Tank.h"
+#include "BinaryStream.h"
 #include <algorithm>
 
 Tank::Tank(Point pos, Direction dir, int spd, int hp, int fireRate)
@@ -211,3 +212,33 @@ int Tank::getSpeedSlowDuration() const {
 int Tank::getSpeedSlow() const {
     return speedSlow;
 }
+
+void Tank::save(BinaryWriter& out) const {
+    GameObject::save(out);
+    out.writeInt(fireRate);
+    out.writeInt(reloadTime);
+    out.writeInt(currentReload);
+    out.writeBool(hasShield);
+    out.writeBool(doubleFire);
+    out.writeInt(speedBoost);
+    out.writeInt(speedSlow);
+    out.writeInt(speedSlowDuration);
+    out.writeInt(shieldDuration);
+    out.writeInt(doubleFireDuration);
+    out.writeInt(speedBoostDuration);
+}
+
+void Tank::load(BinaryReader& in) {
+    GameObject::load(in);
+    fireRate = in.readInt();
+    reloadTime = in.readInt();
+    currentReload = in.readInt();
+    hasShield = in.readBool();
+    doubleFire = in.readBool();
+    speedBoost = in.readInt();
+    speedSlow = in.readInt();
+    speedSlowDuration = in.readInt();
+    shieldDuration = in.readInt();
+    doubleFireDuration = in.readInt();
+    speedBoostDuration = in.readInt();
+}
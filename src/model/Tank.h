@@ -199,6 +199,9 @@ public:
      * @return Character symbol for display.
      */
     virtual char getSymbol() const override = 0;
+
+    void save(BinaryWriter& out) const override;
+    void load(BinaryReader& in) override;
 };
 
 #endif // TANK_H
@@ -0,0 +1,69 @@
+/**
+ * @file TerrainGrid.cpp
+ * @author Vld251
+ * @brief Implementation of the dense terrain grid.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "TerrainGrid.h"
+
+TerrainGrid::TerrainGrid() : width(0), height(0) {}
+
+void TerrainGrid::reset(int w, int h) {
+    width = w;
+    height = h;
+    cells.assign(static_cast<size_t>(w) * h, -1);
+}
+
+void TerrainGrid::setObstacle(const Point& pos, ObstacleType type) {
+    if (!inBounds(pos)) return;
+    cells[pos.y * width + pos.x] = static_cast<signed char>(type);
+}
+
+void TerrainGrid::clearCell(const Point& pos) {
+    if (!inBounds(pos)) return;
+    cells[pos.y * width + pos.x] = -1;
+}
+
+bool TerrainGrid::inBounds(const Point& pos) const {
+    return pos.x >= 0 && pos.x < width && pos.y >= 0 && pos.y < height;
+}
+
+bool TerrainGrid::hasObstacle(const Point& pos) const {
+    return inBounds(pos) && cells[pos.y * width + pos.x] >= 0;
+}
+
+ObstacleType TerrainGrid::getType(const Point& pos) const {
+    return static_cast<ObstacleType>(cells[pos.y * width + pos.x]);
+}
+
+bool TerrainGrid::blocksTanks(const Point& pos) const {
+    if (!inBounds(pos)) return true;
+
+    signed char cell = cells[pos.y * width + pos.x];
+    // Лес проходим, всё остальное - нет
+    return cell >= 0 && static_cast<ObstacleType>(cell) != ObstacleType::FOREST;
+}
+
+bool TerrainGrid::blocksProjectiles(const Point& pos) const {
+    if (!inBounds(pos)) return true;
+
+    signed char cell = cells[pos.y * width + pos.x];
+    if (cell < 0) return false;
+
+    // Снаряды останавливают только стены
+    ObstacleType type = static_cast<ObstacleType>(cell);
+    return type == ObstacleType::BRICK || type == ObstacleType::STEEL;
+}
+
+int TerrainGrid::getWidth() const {
+    return width;
+}
+
+int TerrainGrid::getHeight() const {
+    return height;
+}
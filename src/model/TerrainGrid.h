@@ -0,0 +1,112 @@
+/**
+ * @file TerrainGrid.h
+ * @author Vld251
+ * @brief Dense grid of static obstacles for constant-time terrain queries.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef TERRAINGRID_H
+#define TERRAINGRID_H
+
+#include "GameObject.h"
+#include "Obstacle.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Grid mirroring the obstacles of the game world.
+ * 
+ * Each cell stores the type of obstacle standing on it (or nothing).
+ * Kept in sync by GameWorld when a level is built and when obstacles
+ * are destroyed, so AI and other systems can query terrain without
+ * scanning the object list.
+ */
+class TerrainGrid {
+private:
+    int width;                          ///< Grid width in cells
+    int height;                         ///< Grid height in cells
+    std::vector<signed char> cells;     ///< Obstacle type per cell, -1 if empty
+
+public:
+    /**
+     * @brief Constructs an empty grid.
+     * @returns None
+     */
+    TerrainGrid();
+
+    /**
+     * @brief Resizes grid and clears all cells.
+     * @param w Grid width.
+     * @param h Grid height.
+     * @returns None
+     */
+    void reset(int w, int h);
+
+    /**
+     * @brief Places obstacle of given type into cell.
+     * @param pos Cell position.
+     * @param type Obstacle type.
+     * @returns None
+     */
+    void setObstacle(const Point& pos, ObstacleType type);
+
+    /**
+     * @brief Removes obstacle from cell.
+     * @param pos Cell position.
+     * @returns None
+     */
+    void clearCell(const Point& pos);
+
+    /**
+     * @brief Checks if position is inside the grid.
+     * @param pos Position to check.
+     * @return true if inside, false otherwise.
+     */
+    bool inBounds(const Point& pos) const;
+
+    /**
+     * @brief Checks if cell contains an obstacle.
+     * @param pos Cell position.
+     * @return true if obstacle present, false otherwise.
+     */
+    bool hasObstacle(const Point& pos) const;
+
+    /**
+     * @brief Gets obstacle type in cell.
+     * @param pos Cell position (must contain an obstacle).
+     * @return Obstacle type.
+     */
+    ObstacleType getType(const Point& pos) const;
+
+    /**
+     * @brief Checks if cell blocks tank movement (outside is blocking).
+     * @param pos Cell position.
+     * @return true if blocking, false otherwise.
+     */
+    bool blocksTanks(const Point& pos) const;
+
+    /**
+     * @brief Checks if cell stops projectiles (outside is blocking).
+     * @param pos Cell position.
+     * @return true if blocking, false otherwise.
+     */
+    bool blocksProjectiles(const Point& pos) const;
+
+    /**
+     * @brief Gets grid width.
+     * @return Width in cells.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Gets grid height.
+     * @return Height in cells.
+     */
+    int getHeight() const;
+};
+
+#endif // TERRAINGRID_H
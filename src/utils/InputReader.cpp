@@ -0,0 +1,110 @@
+/**
+ * @file InputReader.cpp
+ * @author Vld251
+ * @brief Implementation of the poll()-based buffered keyboard reader.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "InputReader.h"
+
+#ifndef _WIN32
+
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+const int InputReader::BUFFER_SIZE;
+const int InputReader::CONTINUATION_TIMEOUT_MS;
+
+InputReader::InputReader(int descriptor) : fd(descriptor), begin(0), end(0), eof(false) {}
+
+bool InputReader::fill() {
+    // Сдвигаем непрочитанный хвост в начало буфера
+    if (begin > 0) {
+        std::memmove(buffer, buffer + begin, end - begin);
+        end -= begin;
+        begin = 0;
+    }
+    if (end == BUFFER_SIZE) return true;
+
+    ssize_t count;
+    do {
+        count = ::read(fd, buffer + end, BUFFER_SIZE - end);
+    } while (count < 0 && errno == EINTR);
+
+    if (count <= 0) {
+        // Закрытый терминал (0 байт или EIO) больше ничего не пришлёт
+        if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) eof = true;
+        return false;
+    }
+    end += static_cast<int>(count);
+    return true;
+}
+
+bool InputReader::fillWithin(int timeoutMs) {
+    struct pollfd request;
+    request.fd = fd;
+    request.events = POLLIN;
+    if (poll(&request, 1, timeoutMs) <= 0 || !(request.revents & (POLLIN | POLLHUP | POLLERR))) return false;
+    return fill();
+}
+
+bool InputReader::hasInput() {
+    if (begin < end || eof) return true;
+    return fillWithin(0) || eof;
+}
+
+bool InputReader::waitForInput(int timeoutMs, int wakeFd) {
+    // Конец ввода тоже "готов к чтению": readByte сообщит о нём
+    if (begin < end || eof) return true;
+
+    struct pollfd requests[2];
+    requests[0].fd = fd;
+    requests[0].events = POLLIN;
+    requests[1].fd = wakeFd;
+    requests[1].events = POLLIN;
+    int count = wakeFd >= 0 ? 2 : 1;
+
+    // Прерывание сигналом (EINTR) возвращает управление вызывающему
+    int result = poll(requests, count, timeoutMs);
+    if (result <= 0) return false;
+
+    if (count == 2 && (requests[1].revents & POLLIN)) {
+        // Вычитываем все накопившиеся пробуждения
+        char drain[64];
+        while (::read(wakeFd, drain, sizeof(drain)) > 0) {}
+    }
+    if (!(requests[0].revents & (POLLIN | POLLHUP | POLLERR))) return false;
+    return fill() || eof;
+}
+
+int InputReader::readByte() {
+    if (begin == end && (eof || !fill())) return -1;
+    return static_cast<unsigned char>(buffer[begin++]);
+}
+
+std::string InputReader::readUTF8Char() {
+    if (begin == end && (eof || !fill())) return "";
+
+    // Длина UTF-8 последовательности по первому байту
+    unsigned char first = static_cast<unsigned char>(buffer[begin]);
+    int numBytes = 1;
+    if ((first & 0xE0) == 0xC0) numBytes = 2;
+    else if ((first & 0xF0) == 0xE0) numBytes = 3;
+    else if ((first & 0xF8) == 0xF0) numBytes = 4;
+
+    // Остаток символа почти всегда пришел тем же read(); если нет - ждем его, но недолго
+    while (end - begin < numBytes && fillWithin(CONTINUATION_TIMEOUT_MS)) {}
+    if (numBytes > end - begin) numBytes = end - begin;
+
+    std::string result(buffer + begin, numBytes);
+    begin += numBytes;
+    return result;
+}
+
+#endif // _WIN32
@@ -0,0 +1,81 @@
+/**
+ * @file InputReader.h
+ * @author Vld251
+ * @brief Buffered keyboard reader built on poll() and read().
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef INPUTREADER_H
+#define INPUTREADER_H
+
+#ifndef _WIN32
+
+#include <string>
+
+/**
+ * @brief Reads terminal input in chunks and hands it out one character at a time.
+ * 
+ * Expects the terminal to be in raw mode already (see TerminalSession), so
+ * no terminal attributes are touched here. Checking for a key costs at most
+ * one poll() and nothing at all while bytes are still buffered; escape
+ * sequences and multi-byte characters usually arrive in a single read().
+ */
+class InputReader {
+private:
+    static const int BUFFER_SIZE = 256;             ///< Bytes read per read() call
+    static const int CONTINUATION_TIMEOUT_MS = 50;  ///< Wait for the rest of a split character
+
+    int fd;                     ///< Descriptor to read from
+    char buffer[BUFFER_SIZE];   ///< Bytes read but not handed out yet
+    int begin;                  ///< First unread byte in buffer
+    int end;                    ///< One past the last unread byte
+    bool eof;                   ///< Input ended (EOF or read error); readByte reports it as -1
+
+    bool fill();                ///< Reads available bytes into buffer, false on EOF or error
+    bool fillWithin(int timeoutMs); ///< Waits for input, then fills buffer
+
+public:
+    /**
+     * @brief Constructs a reader of a descriptor.
+     * @param descriptor Descriptor to read, usually standard input.
+     * @returns None
+     */
+    explicit InputReader(int descriptor);
+
+    /**
+     * @brief Checks without waiting if input is available.
+     * @return true if readByte will not block (a byte or end of input), false otherwise.
+     */
+    bool hasInput();
+
+    /**
+     * @brief Waits until input is available, a wake descriptor fires or the timeout passes.
+     *
+     * Bytes pending on the wake descriptor are consumed, so it can be a
+     * self-pipe written from a signal handler.
+     * @param timeoutMs Maximum wait in milliseconds, -1 to wait without limit.
+     * @param wakeFd Descriptor that ends the wait early, -1 for none.
+     * @return true if input is available or has ended, false on wake-up, timeout or signal.
+     */
+    bool waitForInput(int timeoutMs, int wakeFd);
+
+    /**
+     * @brief Reads one byte, blocking until it arrives.
+     * @return Byte value 0-255, or -1 at end of input.
+     */
+    int readByte();
+
+    /**
+     * @brief Reads one UTF-8 character, blocking until its first byte arrives.
+     * @return UTF-8 character, or empty string at end of input.
+     */
+    std::string readUTF8Char();
+};
+
+#endif // _WIN32
+
+#endif // INPUTREADER_H
@@ -0,0 +1,85 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @author Vld251
+ * @brief Implementation of the logarithmic latency histogram.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "LatencyHistogram.h"
+
+const int LatencyHistogram::SUB_BITS;
+const int LatencyHistogram::SUB_BUCKETS;
+const int LatencyHistogram::BUCKET_COUNT;
+
+LatencyHistogram::LatencyHistogram() : samples(0), maxMicros(0) {
+    for (std::atomic<unsigned long>& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+int LatencyHistogram::bucketOf(unsigned long micros) {
+    if (micros >= 0xFFFFFFFFul) return BUCKET_COUNT - 1;
+    if (micros < static_cast<unsigned long>(SUB_BUCKETS)) return static_cast<int>(micros);
+
+    // Номер старшего бита задает степень двойки, следующие SUB_BITS битов - часть внутри неё
+    int exponent = 0;
+    while ((micros >> (exponent + 1)) != 0) exponent++;
+    int sub = static_cast<int>((micros >> (exponent - SUB_BITS)) & (SUB_BUCKETS - 1));
+    return (exponent - SUB_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+unsigned long LatencyHistogram::bucketStart(int bucket) {
+    if (bucket < SUB_BUCKETS) return static_cast<unsigned long>(bucket);
+
+    int exponent = bucket / SUB_BUCKETS + SUB_BITS - 1;
+    unsigned long sub = static_cast<unsigned long>(bucket % SUB_BUCKETS);
+    return (static_cast<unsigned long>(SUB_BUCKETS) | sub) << (exponent - SUB_BITS);
+}
+
+void LatencyHistogram::record(double seconds) {
+    double micros = seconds * 1e6;
+    unsigned long value = micros <= 0.0 ? 0 :
+                          micros >= 4294967295.0 ? 0xFFFFFFFFul : static_cast<unsigned long>(micros);
+
+    buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+    samples.fetch_add(1, std::memory_order_relaxed);
+
+    unsigned long previous = maxMicros.load(std::memory_order_relaxed);
+    while (value > previous && !maxMicros.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {}
+}
+
+unsigned long LatencyHistogram::count() const {
+    return samples.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::percentileMillis(double fraction) const {
+    unsigned long total = count();
+    if (total == 0) return 0.0;
+
+    // Номер образца, на который приходится процентиль (с единицы)
+    unsigned long rank = static_cast<unsigned long>(fraction * static_cast<double>(total) + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > total) rank = total;
+
+    unsigned long seen = 0;
+    for (int bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+        seen += buckets[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            unsigned long start = bucketStart(bucket);
+            unsigned long end = bucket + 1 < BUCKET_COUNT ? bucketStart(bucket + 1) : start + 1;
+            double middle = (static_cast<double>(start) + static_cast<double>(end)) / 2.0;
+            double largest = static_cast<double>(maxMicros.load(std::memory_order_relaxed));
+            // Середина корзины не может быть больше самого большого образца
+            return (middle < largest ? middle : largest) / 1000.0;
+        }
+    }
+    return maxMillis();
+}
+
+double LatencyHistogram::maxMillis() const {
+    return static_cast<double>(maxMicros.load(std::memory_order_relaxed)) / 1000.0;
+}
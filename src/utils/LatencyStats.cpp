@@ -0,0 +1,74 @@
+/**
+ * @file LatencyStats.cpp
+ * @author Vld251
+ * @brief Implementation of per-stage latency statistics.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "LatencyStats.h"
+#include <cstdio>
+
+const int LatencyStats::STAGE_COUNT;
+
+void LatencyStats::record(LatencyStage stage, Clock::duration elapsed) {
+    histograms[static_cast<int>(stage)].record(std::chrono::duration<double>(elapsed).count());
+}
+
+const LatencyHistogram& LatencyStats::get(LatencyStage stage) const {
+    return histograms[static_cast<int>(stage)];
+}
+
+std::string LatencyStats::describe() const {
+    const LatencyHistogram& total = get(LatencyStage::TOTAL);
+    if (total.count() == 0) {
+        return "key->frame: no samples";
+    }
+
+    char text[160];
+    int length = std::snprintf(text, sizeof(text),
+                  "key->frame p50 %.1f p99 %.1f ms | p99 decode %.1f queue %.1f sim %.1f out %.1f",
+                  total.percentileMillis(0.5), total.percentileMillis(0.99),
+                  get(LatencyStage::DECODE).percentileMillis(0.99),
+                  get(LatencyStage::QUEUE).percentileMillis(0.99),
+                  get(LatencyStage::SIMULATION).percentileMillis(0.99),
+                  get(LatencyStage::OUTPUT).percentileMillis(0.99));
+
+    // Опоздание тиков есть только в режиме реального времени
+    const LatencyHistogram& jitter = get(LatencyStage::TICK_JITTER);
+    if (jitter.count() > 0 && length > 0 && length < static_cast<int>(sizeof(text))) {
+        std::snprintf(text + length, sizeof(text) - length, " tick %.1f", jitter.percentileMillis(0.99));
+    }
+    return text;
+}
+
+void LatencyStats::report(std::ostream& out) const {
+    char header[128];
+    std::snprintf(header, sizeof(header), "%-10s %9s %11s %11s %11s %11s\n",
+                  "stage", "samples", "p50 ms", "p90 ms", "p99 ms", "max ms");
+    out << header;
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        const LatencyHistogram& histogram = histograms[i];
+        char line[128];
+        std::snprintf(line, sizeof(line), "%-10s %9lu %11.3f %11.3f %11.3f %11.3f\n",
+                      stageName(static_cast<LatencyStage>(i)), histogram.count(),
+                      histogram.percentileMillis(0.5), histogram.percentileMillis(0.9),
+                      histogram.percentileMillis(0.99), histogram.maxMillis());
+        out << line;
+    }
+}
+
+const char* LatencyStats::stageName(LatencyStage stage) {
+    switch (stage) {
+        case LatencyStage::DECODE:     return "decode";
+        case LatencyStage::QUEUE:      return "queue";
+        case LatencyStage::SIMULATION: return "simulation";
+        case LatencyStage::OUTPUT:     return "output";
+        case LatencyStage::TOTAL:      return "total";
+        case LatencyStage::TICK_JITTER: return "tick";
+    }
+    return "?";
+}
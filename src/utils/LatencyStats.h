@@ -0,0 +1,85 @@
+/**
+ * @file LatencyStats.h
+ * @author Vld251
+ * @brief Key-to-frame latency histograms, one per pipeline stage.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef LATENCYSTATS_H
+#define LATENCYSTATS_H
+
+#include "LatencyHistogram.h"
+
+#include <chrono>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Stages a key press passes on its way to the screen.
+ */
+enum class LatencyStage {
+    DECODE,       ///< First byte read until the key is decoded (includes the lone ESC timeout)
+    QUEUE,        ///< Key decoded until the game thread applies it (includes waiting for a tick)
+    SIMULATION,   ///< processCommand and GameWorld::update
+    OUTPUT,       ///< Snapshot published until written to the terminal
+    TOTAL,        ///< First byte read until the frame showing its effect is written
+    TICK_JITTER   ///< Tick deadline until the tick starts (realtime mode only)
+};
+
+/**
+ * @brief Latency histograms of all stages.
+ * 
+ * Input stages are recorded by the game thread, output stages by the
+ * render thread; the overlay reads them while both are running.
+ */
+class LatencyStats {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    static const int STAGE_COUNT = 6;   ///< Number of LatencyStage values
+
+private:
+    LatencyHistogram histograms[STAGE_COUNT];   ///< Histogram per stage
+
+public:
+    /**
+     * @brief Records one sample of a stage.
+     * @param stage Pipeline stage.
+     * @param elapsed Time spent in the stage.
+     * @returns None
+     */
+    void record(LatencyStage stage, Clock::duration elapsed);
+
+    /**
+     * @brief Gets histogram of a stage.
+     * @param stage Pipeline stage.
+     * @return Histogram reference.
+     */
+    const LatencyHistogram& get(LatencyStage stage) const;
+
+    /**
+     * @brief Builds one-line summary for the debug overlay.
+     * @return End-to-end median and 99th percentile, and 99th percentile of each stage.
+     */
+    std::string describe() const;
+
+    /**
+     * @brief Writes a table with sample counts and percentiles of every stage.
+     * @param out Stream to write to.
+     * @returns None
+     */
+    void report(std::ostream& out) const;
+
+    /**
+     * @brief Gets name of a stage.
+     * @param stage Pipeline stage.
+     * @return Stage name.
+     */
+    static const char* stageName(LatencyStage stage);
+};
+
+#endif // LATENCYSTATS_H
@@ -11,6 +11,7 @@
 
 #include "MapManager.h"
 #include "../model/PlayerTank.h"
+#include "../model/EnemyArchetypes.h"
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -513,42 +514,14 @@ void MapManager::createWorldFromMap(GameWorld& world, const MapInfo& map) {
             }
         }
     }
+    
+    // Синхронизируем сетку препятствий мира с новой картой
+    world.refreshTerrain();
 }
 
 EnemyTankType MapManager::getRandomTankType(int level, std::mt19937& gen) const {
-    std::uniform_int_distribution<> typeDist(0, 100);
-    int typeRoll = typeDist(gen);
-    
-    if (level >= 2) {
-        if (typeRoll < 50) { // 50% - обычные танки
-            return EnemyTankType::BASIC;
-        } else if (typeRoll < 70) { // 20% - быстрые танки
-            return EnemyTankType::FAST;
-        } else if (typeRoll < 85) { // 15% - танки с уроном
-            return EnemyTankType::DAMAGE;
-        } else { // 15% - бронированные танки
-            return EnemyTankType::ARMORED;
-        }
-    } else {
-        // На первом уровне только обычные танки
-        return EnemyTankType::BASIC;
-    }
-    
-    // На высоких уровнях увеличиваем шанс появления специальных танков
-    if (level >= 4) {
-        typeRoll = typeDist(gen); // Перебрасываем кубик
-        if (typeRoll < 30) { // 30% - обычные
-            return EnemyTankType::BASIC;
-        } else if (typeRoll < 55) { // 25% - быстрые
-            return EnemyTankType::FAST;
-        } else if (typeRoll < 75) { // 20% - с уроном
-            return EnemyTankType::DAMAGE;
-        } else { // 25% - бронированные
-            return EnemyTankType::ARMORED;
-        }
-    }
-    
-    return EnemyTankType::BASIC;
+    std::uniform_int_distribution<> typeDist(0, EnemyArchetypes::SPAWN_ROLL_RANGE - 1);
+    return EnemyArchetypes::rollType(level, typeDist(gen));
 }
 
 bool MapManager::isValidEnemyPosition(const Point& pos, const MapInfo& map, const PlayerTank* player) const {
@@ -14,15 +14,27 @@
 
 #ifdef _WIN32
     HANDLE PlatformUtils::hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-#else
-    struct termios PlatformUtils::oldt;
 #endif
 
 void PlatformUtils::clearScreen() {
 #ifdef _WIN32
     system("cls");
 #else
-    system("clear");
+    // Курсор в начало и очистка экрана без запуска внешнего процесса
+    std::cout << "\033[H\033[2J";
+#endif
+}
+
+void PlatformUtils::enterAlternateScreen() {
+#ifndef _WIN32
+    // Альтернативный буфер экрана и скрытый курсор
+    std::cout << "\033[?1049h\033[?25l" << std::flush;
+#endif
+}
+
+void PlatformUtils::leaveAlternateScreen() {
+#ifndef _WIN32
+    std::cout << "\033[0m\033[?25h\033[?1049l" << std::flush;
 #endif
 }
 
@@ -32,8 +44,41 @@ void PlatformUtils::clearScreen() {
 #include <sys/ioctl.h>
 #include <unistd.h>
 #include <stdio.h>
+#include <signal.h>
+#include "InputReader.h"
 #endif
 #include <cstring>
+#include <atomic>
+
+namespace {
+
+std::atomic<unsigned> resizeGeneration(0);  ///< Incremented by SIGWINCH handler
+std::atomic<bool> resizeHandlerInstalled(false);
+std::atomic<bool> cachedSizeValid(false);
+std::atomic<unsigned> cachedGeneration(0);  ///< Generation the cached size belongs to
+std::atomic<int> cachedWidth(0);
+std::atomic<int> cachedHeight(0);
+
+#ifndef _WIN32
+int resizePipe[2] = { -1, -1 };             ///< Self-pipe waking poll() on resize
+
+InputReader& stdinReader() {
+    static InputReader reader(STDIN_FILENO);
+    return reader;
+}
+
+void onResizeSignal(int) {
+    // В обработчике сигнала допустимы только атомики и write()
+    resizeGeneration.fetch_add(1);
+    if (resizePipe[1] >= 0) {
+        char byte = 1;
+        ssize_t result = ::write(resizePipe[1], &byte, 1);
+        (void)result;
+    }
+}
+#endif
+
+} // namespace
 
 std::pair<int, int> PlatformUtils::getTerminalSize() {
 #ifdef _WIN32
@@ -49,6 +94,82 @@ std::pair<int, int> PlatformUtils::getTerminalSize() {
 #endif
 }
 
+void PlatformUtils::installResizeHandler() {
+#ifndef _WIN32
+    if (resizeHandlerInstalled) return;
+
+    if (pipe(resizePipe) == 0) {
+        for (int fd : resizePipe) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+    } else {
+        resizePipe[0] = resizePipe[1] = -1;
+    }
+
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = onResizeSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (sigaction(SIGWINCH, &action, nullptr) == 0) {
+        resizeHandlerInstalled = true;
+    }
+#endif
+}
+
+unsigned PlatformUtils::getResizeGeneration() {
+    return resizeGeneration.load();
+}
+
+std::pair<int, int> PlatformUtils::getCachedTerminalSize() {
+    if (!resizeHandlerInstalled) {
+        return getTerminalSize();
+    }
+
+    // Размер запрашивается у терминала только после SIGWINCH
+    unsigned generation = resizeGeneration.load();
+    if (!cachedSizeValid || cachedGeneration.load() != generation) {
+        std::pair<int, int> size = getTerminalSize();
+        cachedWidth = size.first;
+        cachedHeight = size.second;
+        cachedGeneration = generation;
+        cachedSizeValid = true;
+        return size;
+    }
+    return { cachedWidth.load(), cachedHeight.load() };
+}
+
+bool PlatformUtils::waitForInputOrResize(int timeoutMs) {
+#ifdef _WIN32
+    // Уведомлений о смене размера нет - ждем не дольше полсекунды,
+    // после чего вызывающий код перепроверит размер
+    int limit = (timeoutMs < 0 || timeoutMs > 500) ? 500 : timeoutMs;
+    for (int waited = 0; waited < limit; waited += 50) {
+        if (_kbhit()) return true;
+        Sleep(limit - waited < 50 ? limit - waited : 50);
+    }
+    return _kbhit() != 0;
+#else
+    if (!resizeHandlerInstalled && timeoutMs < 0) {
+        timeoutMs = 500;
+    }
+
+    // Прерывание сигналом (EINTR) считаем пробуждением из-за смены размера
+    return stdinReader().waitForInput(timeoutMs, resizePipe[0]);
+#endif
+}
+
+void PlatformUtils::interruptInputWait() {
+#ifndef _WIN32
+    if (resizePipe[1] >= 0) {
+        char byte = 1;
+        ssize_t result = ::write(resizePipe[1], &byte, 1);
+        (void)result;
+    }
+#endif
+}
+
 bool PlatformUtils::isTerminalSizeValid(int minWidth, int minHeight) {
     auto terminalSize = PlatformUtils::getTerminalSize();
     int width = terminalSize.first;
@@ -91,26 +212,8 @@ bool PlatformUtils::kbhit() {
 #ifdef _WIN32
     return _kbhit() != 0;
 #else
-    struct termios newt;
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    
-    int oldf = fcntl(STDIN_FILENO, F_GETFL, 0);
-    fcntl(STDIN_FILENO, F_SETFL, oldf | O_NONBLOCK);
-    
-    int ch = getchar();
-    
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-    fcntl(STDIN_FILENO, F_SETFL, oldf);
-    
-    if (ch != EOF) {
-        ungetc(ch, stdin);
-        return true;
-    }
-    
-    return false;
+    // Терминал уже в сыром режиме (TerminalSession) - один poll(), если буфер пуст
+    return stdinReader().hasInput();
 #endif
 }
 
@@ -141,44 +244,20 @@ std::string PlatformUtils::readUTF8Char() {
         result += static_cast<char>(ch);
     }
 #else
-    struct termios newt;
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    
-    // Читаем первый байт
-    int firstByte = getchar();
-    if (firstByte == EOF) {
-        tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-        return result;
-    }
-    
-    result += static_cast<char>(firstByte);
-    
-    // Определяем длину UTF-8 последовательности по первому байту
-    int numBytes = 1;
-    if ((firstByte & 0xE0) == 0xC0) numBytes = 2;
-    else if ((firstByte & 0xF0) == 0xE0) numBytes = 3;
-    else if ((firstByte & 0xF8) == 0xF0) numBytes = 4;
-    
-    // Читаем оставшиеся байты
-    for (int i = 1; i < numBytes; ++i) {
-        if (!kbhit()) {
-            usleep(1000);
-        }
-        int nextByte = getchar();
-        if (nextByte != EOF) {
-            result += static_cast<char>(nextByte);
-        }
-    }
-    
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
+    result = stdinReader().readUTF8Char();
 #endif
     
     return result;
 }
 
+int PlatformUtils::readByte() {
+#ifdef _WIN32
+    return _getch();
+#else
+    return stdinReader().readByte();
+#endif
+}
+
 void PlatformUtils::sleep(int milliseconds) {
 #ifdef _WIN32
     Sleep(milliseconds);
@@ -187,6 +266,14 @@ void PlatformUtils::sleep(int milliseconds) {
 #endif
 }
 
+bool PlatformUtils::replaceFile(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
 void PlatformUtils::setColor(Color color) {
 #ifdef _WIN32
     HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
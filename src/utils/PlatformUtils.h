@@ -39,6 +39,18 @@ public:
      */
     static void clearScreen();
     
+    /**
+     * @brief Switches terminal to alternate screen buffer and hides cursor.
+     * @returns None
+     */
+    static void enterAlternateScreen();
+    
+    /**
+     * @brief Restores main screen buffer and cursor.
+     * @returns None
+     */
+    static void leaveAlternateScreen();
+    
     /**
      * @brief Sets cursor position in terminal.
      * @param x X-coordinate (column).
@@ -49,15 +61,31 @@ public:
     
     /**
      * @brief Checks if a key has been pressed.
+     * 
+     * Input is read in chunks into a buffer, so this costs at most one
+     * poll() and nothing while buffered bytes remain. Expects the terminal
+     * to be in raw mode (see TerminalSession).
      * @return true if key pressed, false otherwise.
      */
     static bool kbhit();
     
     /**
      * @brief Reads a single UTF-8 character from input.
+     * 
+     * Blocks until the first byte arrives; bytes of the same character that
+     * are not buffered yet are waited for briefly without sleeping.
      * @return UTF-8 character as string.
      */
     static std::string readUTF8Char();
+
+    /**
+     * @brief Reads a single raw byte from input.
+     * 
+     * Blocks until the byte arrives; escape sequences and multi-byte
+     * characters are left to the caller to decode.
+     * @return Byte value 0-255, or -1 at end of input.
+     */
+    static int readByte();
     
     /**
      * @brief Pauses execution for specified milliseconds.
@@ -65,6 +93,18 @@ public:
      * @returns None
      */
     static void sleep(int milliseconds);
+
+    /**
+     * @brief Replaces a file with another one in a single step.
+     * 
+     * Uses rename on POSIX and MoveFileEx with MOVEFILE_REPLACE_EXISTING on
+     * Windows, where rename does not overwrite. On failure the target file
+     * is left as it was.
+     * @param from Path of the new file.
+     * @param to Path of the file to replace.
+     * @return true if the file was replaced, false otherwise.
+     */
+    static bool replaceFile(const std::string& from, const std::string& to);
     
     /**
      * @brief Enumeration representing terminal colors.
@@ -124,6 +164,46 @@ public:
      * @return Pair of integers (width, height).
      */
     static std::pair<int, int> getTerminalSize();
+
+    /**
+     * @brief Installs SIGWINCH handler that records terminal resizes.
+     * 
+     * Without it (or on Windows) resize-aware functions fall back to
+     * querying the terminal on every call.
+     * @returns None
+     */
+    static void installResizeHandler();
+
+    /**
+     * @brief Gets counter incremented by every terminal resize.
+     * @return Resize generation number.
+     */
+    static unsigned getResizeGeneration();
+
+    /**
+     * @brief Gets terminal dimensions, querying the terminal only after a resize.
+     * 
+     * Safe to call from several threads.
+     * @return Pair of integers (width, height).
+     */
+    static std::pair<int, int> getCachedTerminalSize();
+
+    /**
+     * @brief Waits until a key is pressed or the terminal is resized.
+     * @param timeoutMs Maximum wait in milliseconds, -1 to wait without limit.
+     *                  Platforms without resize notifications wake up periodically.
+     * @return true if input is available, false on resize or timeout.
+     */
+    static bool waitForInputOrResize(int timeoutMs);
+
+    /**
+     * @brief Wakes a thread blocked in waitForInputOrResize as if the terminal was resized.
+     * 
+     * The resize generation does not change, so the woken thread can tell
+     * this apart from a real resize.
+     * @returns None
+     */
+    static void interruptInputWait();
     
     /**
      * @brief Checks if terminal meets minimum size requirements.
@@ -145,8 +225,6 @@ private:
     // Platform-specific variables
 #ifdef _WIN32
     static HANDLE hConsole;  ///< Windows console handle
-#else
-    static struct termios oldt;  ///< Unix terminal settings backup
 #endif
 };
 
@@ -10,47 +10,92 @@
  */
 
 #include "ScoreManager.h"
-#include <fstream>
+#include "PlatformUtils.h"
 #include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <fstream>
 #include <iostream>
 
-ScoreManager::ScoreManager() : scoreFile("highscores.txt") {
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+const int ScoreManager::MAX_SCORES;
+const int ScoreManager::BATCH_DELAY_MS;
+
+namespace {
+
+// Пишет таблицу во временный файл и подменяет им старый: файл всегда целый
+bool writeScoresAtomically(const std::string& path, const std::vector<int>& scores) {
+    std::string tempPath = path + ".tmp";
+    FILE* file = std::fopen(tempPath.c_str(), "w");
+    if (!file) return false;
+
+    bool ok = true;
+    for (int score : scores) {
+        if (std::fprintf(file, "%d\n", score) < 0) ok = false;
+    }
+
+    // Данные должны дойти до диска раньше, чем rename сделает их видимыми
+    ok = std::fflush(file) == 0 && ok;
+#ifdef _WIN32
+    ok = _commit(_fileno(file)) == 0 && ok;
+#else
+    ok = fsync(fileno(file)) == 0 && ok;
+#endif
+    ok = std::fclose(file) == 0 && ok;
+
+    // Старая таблица не удаляется заранее: при неудаче она остаётся целой
+    ok = ok && PlatformUtils::replaceFile(tempPath, path);
+    if (!ok) std::remove(tempPath.c_str());
+    return ok;
+}
+
+}
+
+ScoreManager::ScoreManager() : scoreFile("highscores.txt"), pending(false), writing(false), stopping(false) {
     loadScores();
 }
 
-ScoreManager::ScoreManager(const std::string& filename) : scoreFile(filename) {
+ScoreManager::ScoreManager(const std::string& filename)
+    : scoreFile(filename), pending(false), writing(false), stopping(false) {
     loadScores();
 }
 
-void ScoreManager::addScore(int score) {
-    if (score <= 0) return;
-    
-    std::cout << "Adding score to high scores table: " << score << std::endl;
-    
-    // Проверяем, является ли счет рекордом
-    if (!isHighScore(score)) {
-        std::cout << "Score " << score << " is not a high score." << std::endl;
-        return;
+ScoreManager::~ScoreManager() {
+    if (!writer.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
     }
-    
-    // Добавляем счет и сортируем
-    highScores.push_back(score);
-    std::sort(highScores.rbegin(), highScores.rend());
-    
-    highScores.erase(std::unique(highScores.begin(), highScores.end()), highScores.end());
-    
-    // Ограничиваем размер
-    if (highScores.size() > MAX_SCORES) {
-        highScores.resize(MAX_SCORES);
+    wake.notify_one();
+    writer.join();
+}
+
+bool ScoreManager::insertScore(int score) {
+    // Таблица отсортирована по убыванию: место нового счёта - перед первым меньшим
+    auto position = std::lower_bound(highScores.begin(), highScores.end(), score, std::greater<int>());
+    if (position != highScores.end() && *position == score) return false;
+    if (position - highScores.begin() >= MAX_SCORES) return false;
+
+    highScores.insert(position, score);
+    if (highScores.size() > static_cast<size_t>(MAX_SCORES)) {
+        highScores.pop_back();
     }
-    
-    saveScores();
-    
-    std::cout << "Updated high scores table: ";
-    for (int s : highScores) {
-        std::cout << s << " ";
+    return true;
+}
+
+void ScoreManager::addScore(int score) {
+    if (score <= 0) return;
+
+    // Вывод в консоль здесь испортил бы игровой экран - только вставка и фоновая запись
+    if (insertScore(score)) {
+        saveScores();
     }
-    std::cout << std::endl;
 }
 
 bool ScoreManager::isHighScore(int score) const {
@@ -65,15 +110,46 @@ std::vector<int> ScoreManager::getHighScores() const {
 }
 
 void ScoreManager::saveScores() {
-    std::ofstream file(scoreFile);
-    if (file.is_open()) {
-        for (int score : highScores) {
-            file << score << std::endl;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pendingScores = highScores;
+        pending = true;
+    }
+    if (!writer.joinable()) {
+        writer = std::thread(&ScoreManager::writerLoop, this);
+    }
+    wake.notify_one();
+}
+
+void ScoreManager::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    written.wait(lock, [this] { return !pending && !writing; });
+}
+
+void ScoreManager::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        wake.wait(lock, [this] { return pending || stopping; });
+        if (!pending) break; // Остановка, и всё уже записано
+
+        // Несколько рекордов подряд (конец игры, выход в меню) пишутся одним разом
+        wake.wait_for(lock, std::chrono::milliseconds(BATCH_DELAY_MS), [this] { return stopping; });
+
+        std::vector<int> scores;
+        scores.swap(pendingScores);
+        pending = false;
+        writing = true;
+        lock.unlock();
+
+        bool ok = writeScoresAtomically(scoreFile, scores);
+
+        lock.lock();
+        writing = false;
+        if (!ok) {
+            std::cerr << "Error: failed to save high scores: " << scoreFile << std::endl;
         }
-        file.close();
-        std::cout << "High scores saved to file: " << scoreFile << std::endl;
-    } else {
-        std::cerr << "Error: failed to open file for saving high scores: " << scoreFile << std::endl;
+        written.notify_all();
     }
 }
 
@@ -85,7 +161,7 @@ void ScoreManager::loadScores() {
         int score;
         while (file >> score) {
             if (score > 0) {
-                highScores.push_back(score);
+                insertScore(score);
             }
         }
         file.close();
@@ -94,17 +170,9 @@ void ScoreManager::loadScores() {
         std::cout << "High scores file not found, a new one will be created." << std::endl;
 
     }
-    
-    std::sort(highScores.rbegin(), highScores.rend());
-    highScores.erase(std::unique(highScores.begin(), highScores.end()), highScores.end());
-    
-    if (highScores.size() > MAX_SCORES) {
-        highScores.resize(MAX_SCORES);
-    }
 }
 
 void ScoreManager::clearScores() {
     highScores.clear();
     saveScores();
-    std::cout << "High scores table cleared." << std::endl;
 }
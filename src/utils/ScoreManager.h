@@ -14,20 +14,40 @@
 
 #include <vector>
 #include <string>
-#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 /**
  * @brief Class for managing high scores and player achievements.
  * 
  * Handles loading, saving, and maintaining a high scores table.
  * Supports multiple high scores with automatic sorting and ranking.
+ * 
+ * The table lives on the game thread; saving hands a copy to a background
+ * writer, which batches updates arriving close together and replaces the
+ * file atomically (temporary file, then rename), so neither a crash nor a
+ * slow disk can leave a half-written table or stall the game.
  */
 class ScoreManager {
 private:
     std::vector<int> highScores;        ///< List of high scores (sorted descending)
     static const int MAX_SCORES = 3;    ///< Maximum number of high scores to keep
+    static const int BATCH_DELAY_MS = 200; ///< Writer waits this long for more updates before writing
     std::string scoreFile;              ///< Path to high scores file
 
+    std::thread writer;                 ///< Background writer thread
+    std::mutex mutex;                   ///< Guards the fields below
+    std::condition_variable wake;       ///< Signals a new table or stop request
+    std::condition_variable written;    ///< Signals that the writer caught up
+    std::vector<int> pendingScores;     ///< Table waiting to be written
+    bool pending;                       ///< pendingScores has not been written yet
+    bool writing;                       ///< Writer is writing the file
+    bool stopping;                      ///< Writer should write what is left and exit
+
+    bool insertScore(int score);        ///< Inserts into the bounded table; false if it does not fit
+    void writerLoop();                  ///< Writer thread body
+
 public:
     /**
      * @brief Constructs a ScoreManager with default score file.
@@ -41,6 +61,12 @@ public:
      * @returns None
      */
     ScoreManager(const std::string& filename);
+
+    /**
+     * @brief Writes pending scores and stops the writer.
+     * @returns None
+     */
+    ~ScoreManager();
     
     /**
      * @brief Adds a new score to high scores table.
@@ -56,10 +82,16 @@ public:
     std::vector<int> getHighScores() const;
     
     /**
-     * @brief Saves high scores to file.
+     * @brief Queues high scores for saving to file by the background writer.
      * @returns None
      */
     void saveScores();
+
+    /**
+     * @brief Waits until all queued high scores are written.
+     * @returns None
+     */
+    void flush();
     
     /**
      * @brief Loads high scores from file.
@@ -13,21 +13,98 @@
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include "PlatformUtils.h"
 
-SettingsManager::SettingsManager() : settingsFile("tank_game_settings.cfg") {
-    loadSettings();
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Имя файла без каталога: по нему отбираются события каталога
+std::string baseName(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+std::string directoryName(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    if (slash == std::string::npos) return ".";
+    return slash == 0 ? "/" : path.substr(0, slash);
+}
+
+}
+
+SettingsManager::SettingsManager()
+    : settingsFile("tank_game_settings.cfg"), dirty(false), watchFd(-1), fileTime(0) {
+    if (!loadSettings()) {
+        setDefaultSettings();
+    }
+
+#ifdef __linux__
+    // Следим за каталогом, а не за файлом: редакторы заменяют файл новым через rename
+    watchFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watchFd >= 0 && inotify_add_watch(watchFd, directoryName(settingsFile).c_str(),
+                                          IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        close(watchFd);
+        watchFd = -1;
+    }
+#endif
 }
 
 SettingsManager::~SettingsManager() {
     saveSettings();
+#ifdef __linux__
+    if (watchFd >= 0) close(watchFd);
+#endif
+}
+
+SettingsManager::Value SettingsManager::parseValue(const std::string& text) {
+    Value value;
+    value.text = text;
+    value.flag = (text == "1" || text == "true" || text == "yes");
+
+    // Число - только если строка целиком им является и влезает в int
+    char* end = nullptr;
+    errno = 0;
+    long number = std::strtol(text.c_str(), &end, 10);
+    value.isNumber = !text.empty() && end && *end == '\0' && errno == 0 &&
+                     number >= INT_MIN && number <= INT_MAX;
+    value.number = value.isNumber ? static_cast<int>(number) : 0;
+    return value;
 }
 
-void SettingsManager::loadSettings() {
+void SettingsManager::storeValue(const std::string& key, const std::string& text) {
+    auto it = settings.find(key);
+    if (it != settings.end() && it->second.text == text) return;
+
+    settings[key] = parseValue(text);
+    dirty = true;
+    notifyListeners(key);
+}
+
+void SettingsManager::notifyListeners(const std::string& key) {
+    for (const Listener& listener : listeners) {
+        listener(key);
+    }
+}
+
+std::time_t SettingsManager::readFileTime() const {
+    struct stat info;
+    if (stat(settingsFile.c_str(), &info) != 0) return 0;
+    return info.st_mtime;
+}
+
+bool SettingsManager::loadSettings() {
     std::ifstream file(settingsFile);
     if (!file.is_open()) {
-        setDefaultSettings();
-        return;
+        return false;
     }
     
     std::string line;
@@ -36,13 +113,46 @@ void SettingsManager::loadSettings() {
         if (delimiterPos != std::string::npos) {
             std::string key = line.substr(0, delimiterPos);
             std::string value = line.substr(delimiterPos + 1);
-            settings[key] = value;
+            settings[key] = parseValue(value);
         }
     }
     file.close();
+    fileTime = readFileTime();
+    return true;
+}
+
+bool SettingsManager::reloadSettings() {
+    std::ifstream file(settingsFile);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::vector<std::string> changed;
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t delimiterPos = line.find('=');
+        if (delimiterPos == std::string::npos) continue;
+
+        std::string key = line.substr(0, delimiterPos);
+        std::string value = line.substr(delimiterPos + 1);
+        auto it = settings.find(key);
+        if (it == settings.end() || it->second.text != value) {
+            settings[key] = parseValue(value);
+            changed.push_back(key);
+        }
+    }
+    fileTime = readFileTime();
+
+    // Слушатели вызываются после разбора всего файла: связанные ключи уже обновлены
+    for (const std::string& key : changed) {
+        notifyListeners(key);
+    }
+    return !changed.empty();
 }
 
 void SettingsManager::saveSettings() {
+    if (!dirty) return;
+
     std::ofstream file(settingsFile);
     if (!file.is_open()) {
         std::cerr << "Ошибка сохранения настроек!" << std::endl;
@@ -50,49 +160,81 @@ void SettingsManager::saveSettings() {
     }
     
     for (const auto& setting : settings) {
-        file << setting.first << "=" << setting.second << std::endl;
+        file << setting.first << "=" << setting.second.text << '\n';
     }
     file.close();
+    dirty = false;
+    fileTime = readFileTime();
 }
 
 void SettingsManager::setDefaultSettings() {
     // Проверяем поддержку Unicode по умолчанию
     bool defaultUnicode = PlatformUtils::checkUnicodeSupport();
-    settings["advanced_graphics"] = defaultUnicode ? "1" : "0";
-    settings["sound_enabled"] = "1";
-    settings["difficulty"] = "1";
+    storeValue("advanced_graphics", defaultUnicode ? "1" : "0");
+    storeValue("sound_enabled", "1");
+    storeValue("difficulty", "1");
+}
+
+bool SettingsManager::fileChanged() {
+#ifdef __linux__
+    if (watchFd >= 0) {
+        // Вычитываем все события; собственная запись тоже придёт, но ничего не изменит
+        std::string name = baseName(settingsFile);
+        bool changed = false;
+        alignas(struct inotify_event) char buffer[4096];
+        ssize_t length;
+        while ((length = read(watchFd, buffer, sizeof(buffer))) > 0) {
+            for (char* p = buffer; p < buffer + length; ) {
+                const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(p);
+                if (event->len > 0 && name == event->name) changed = true;
+                p += sizeof(struct inotify_event) + event->len;
+            }
+        }
+        return changed;
+    }
+#endif
+    // Без inotify сравниваем время изменения файла
+    std::time_t time = readFileTime();
+    return time != 0 && time != fileTime;
+}
+
+void SettingsManager::addListener(const Listener& listener) {
+    listeners.push_back(listener);
+}
+
+bool SettingsManager::pollChanges() {
+    return fileChanged() && reloadSettings();
 }
 
 void SettingsManager::setSetting(const std::string& key, const std::string& value) {
-    settings[key] = value;
+    storeValue(key, value);
 }
 
-std::string SettingsManager::getSetting(const std::string& key, const std::string& defaultValue) {
+std::string SettingsManager::getSetting(const std::string& key, const std::string& defaultValue) const {
     auto it = settings.find(key);
     if (it != settings.end()) {
-        return it->second;
+        return it->second.text;
     }
     return defaultValue;
 }
 
-bool SettingsManager::getBoolSetting(const std::string& key, bool defaultValue) {
-    std::string value = getSetting(key, defaultValue ? "1" : "0");
-    return (value == "1" || value == "true" || value == "yes");
+bool SettingsManager::getBoolSetting(const std::string& key, bool defaultValue) const {
+    auto it = settings.find(key);
+    return it != settings.end() ? it->second.flag : defaultValue;
 }
 
 void SettingsManager::setBoolSetting(const std::string& key, bool value) {
-    settings[key] = value ? "1" : "0";
+    storeValue(key, value ? "1" : "0");
 }
 
-int SettingsManager::getIntSetting(const std::string& key, int defaultValue) {
-    std::string value = getSetting(key, std::to_string(defaultValue));
-    try {
-        return std::stoi(value);
-    } catch (...) {
-        return defaultValue;
+int SettingsManager::getIntSetting(const std::string& key, int defaultValue) const {
+    auto it = settings.find(key);
+    if (it != settings.end() && it->second.isNumber) {
+        return it->second.number;
     }
+    return defaultValue;
 }
 
 void SettingsManager::setIntSetting(const std::string& key, int value) {
-    settings[key] = std::to_string(value);
+    storeValue(key, std::to_string(value));
 }
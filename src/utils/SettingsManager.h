@@ -14,26 +14,64 @@
 
 #include <string>
 #include <map>
+#include <functional>
+#include <vector>
+#include <ctime>
 
 /**
  * @brief Class for managing game settings and configuration.
  * 
  * Handles loading, saving, and accessing game settings from a configuration file.
  * Supports different data types including strings, booleans, and integers.
+ * 
+ * Values are parsed once when loaded or set, so typed getters cost a map
+ * lookup. The file is rewritten only if something changed. pollChanges()
+ * picks up edits made to the file while the game runs (inotify on Linux,
+ * modification time elsewhere). Listeners learn of every changed key,
+ * whether it was changed through a setter or in the file.
  */
 class SettingsManager {
+public:
+    typedef std::function<void(const std::string& key)> Listener; ///< Called with a key whose value changed
+
 private:
-    std::map<std::string, std::string> settings;  ///< Map of setting key-value pairs
+    /**
+     * @brief Setting value with its typed forms parsed in advance.
+     */
+    struct Value {
+        std::string text;   ///< Value as written in the file
+        bool isNumber;      ///< text is an integer
+        int number;         ///< Integer value, if isNumber
+        bool flag;          ///< Boolean value ("1", "true" or "yes")
+    };
+
+    std::map<std::string, Value> settings;        ///< Map of setting key-value pairs
     std::string settingsFile;                     ///< Path to settings configuration file
-    
+    bool dirty;                                   ///< Settings changed since the file was read or written
+    std::vector<Listener> listeners;              ///< Told about keys whose value changed
+    int watchFd;                                  ///< inotify descriptor, -1 if not watching
+    std::time_t fileTime;                         ///< Modification time of the file when last read or written
+
+    static Value parseValue(const std::string& text); ///< Parses typed forms of a value
+    void storeValue(const std::string& key, const std::string& text); ///< Sets value, marks dirty and notifies if changed
+    void notifyListeners(const std::string& key); ///< Tells listeners that a key changed
+    std::time_t readFileTime() const;             ///< Modification time of the settings file, 0 if missing
+    bool fileChanged();                           ///< Drains change notifications of the settings file
+
     /**
      * @brief Loads settings from configuration file.
-     * @returns None
+     * @return true if the file was read.
      */
-    void loadSettings();
+    bool loadSettings();
+
+    /**
+     * @brief Re-reads the file and notifies listeners of changed values.
+     * @return true if some value changed.
+     */
+    bool reloadSettings();
     
     /**
-     * @brief Saves current settings to configuration file.
+     * @brief Saves current settings to configuration file if they changed.
      * @returns None
      */
     void saveSettings();
@@ -52,9 +90,32 @@ public:
     SettingsManager();
     
     /**
-     * @brief Destructor that saves settings on destruction.
+     * @brief Destructor that saves changed settings on destruction.
      */
     ~SettingsManager();
+
+    SettingsManager(const SettingsManager&) = delete;
+    SettingsManager& operator=(const SettingsManager&) = delete;
+
+    /**
+     * @brief Registers a listener for changed values.
+     * 
+     * Called for values changed through the setters and for values changed
+     * in the file by another program; setting a key to its current value is
+     * not reported.
+     * @param listener Function called with the changed key.
+     * @returns None
+     */
+    void addListener(const Listener& listener);
+
+    /**
+     * @brief Reloads the file if it was changed and notifies listeners.
+     * 
+     * Cheap when nothing changed; call it from the game loop and while
+     * waiting for input.
+     * @return true if some value changed.
+     */
+    bool pollChanges();
     
     /**
      * @brief Sets a string setting value.
@@ -70,7 +131,7 @@ public:
      * @param defaultValue Default value if setting doesn't exist.
      * @return Setting value as string.
      */
-    std::string getSetting(const std::string& key, const std::string& defaultValue = "");
+    std::string getSetting(const std::string& key, const std::string& defaultValue = "") const;
     
     /**
      * @brief Gets a boolean setting value.
@@ -78,7 +139,7 @@ public:
      * @param defaultValue Default value if setting doesn't exist.
      * @return Setting value as boolean.
      */
-    bool getBoolSetting(const std::string& key, bool defaultValue = false);
+    bool getBoolSetting(const std::string& key, bool defaultValue = false) const;
     
     /**
      * @brief Sets a boolean setting value.
@@ -94,7 +155,7 @@ public:
      * @param defaultValue Default value if setting doesn't exist.
      * @return Setting value as integer.
      */
-    int getIntSetting(const std::string& key, int defaultValue = 0);
+    int getIntSetting(const std::string& key, int defaultValue = 0) const;
     
     /**
      * @brief Sets an integer setting value.
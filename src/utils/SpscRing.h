@@ -0,0 +1,85 @@
+/**
+ * @file SpscRing.h
+ * @author Vld251
+ * @brief Lock-free single-producer single-consumer ring buffer.
+ * @version 0.1
+ * @date 2025-12-07
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Fixed-size FIFO queue between exactly one writer and one reader thread.
+ *
+ * Each side owns one index and only reads the other one, so push and pop
+ * never block and never allocate. Unlike TripleBuffer, every value is kept
+ * until it is popped; when the ring is full, push fails and the caller
+ * decides what to drop.
+ *
+ * @tparam T Value type, copied in and out.
+ * @tparam Capacity Number of slots, must be a power of two.
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+private:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static const size_t MASK = Capacity - 1;   ///< Turns a counter into a slot index
+
+    T slots[Capacity];              ///< Stored values
+    std::atomic<size_t> head;       ///< Number of values popped (reader side)
+    std::atomic<size_t> tail;       ///< Number of values pushed (writer side)
+
+public:
+    /**
+     * @brief Constructs an empty ring.
+     * @returns None
+     */
+    SpscRing() : head(0), tail(0) {}
+
+    /**
+     * @brief Appends a value (writer thread only).
+     * @param value Value to append.
+     * @return true if appended, false if the ring is full.
+     */
+    bool push(const T& value) {
+        size_t position = tail.load(std::memory_order_relaxed);
+        if (position - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots[position & MASK] = value;
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest value (reader thread only).
+     * @param value Receives the removed value.
+     * @return true if a value was removed, false if the ring is empty.
+     */
+    bool pop(T& value) {
+        size_t position = head.load(std::memory_order_relaxed);
+        if (position == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = slots[position & MASK];
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Checks if the ring holds no values (either thread).
+     * @return true if empty at the moment of the call.
+     */
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+};
+
+#endif // SPSCRING_H
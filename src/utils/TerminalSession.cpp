@@ -0,0 +1,141 @@
+/**
+ * @file TerminalSession.cpp
+ * @author Vld251
+ * @brief Implementation of the raw-mode terminal session guard.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "TerminalSession.h"
+#include "PlatformUtils.h"
+
+#ifndef _WIN32
+#include <signal.h>
+#include <termios.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace {
+
+#ifndef _WIN32
+// Те же последовательности, что у PlatformUtils, но пишутся через write():
+// std::cout в обработчике сигнала использовать нельзя
+const char ENTER_SCREEN[] = "\033[?1049h\033[?25l";
+const char LEAVE_SCREEN[] = "\033[0m\033[?25h\033[?1049l";
+
+// Сигналы, завершающие процесс: перед выходом возвращаем терминал в исходный вид
+const int TERMINATING_SIGNALS[] = { SIGINT, SIGTERM, SIGHUP, SIGQUIT };
+
+struct termios savedSettings;           // Настройки терминала до начала сессии
+struct termios rawSettings;             // Настройки на время игры
+volatile sig_atomic_t sessionActive = 0;
+
+void writeAll(const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(STDOUT_FILENO, data, size);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return;
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void restoreTerminal() {
+    tcsetattr(STDIN_FILENO, TCSANOW, &savedSettings);
+    writeAll(LEAVE_SCREEN, sizeof(LEAVE_SCREEN) - 1);
+}
+
+void resumeTerminal() {
+    tcsetattr(STDIN_FILENO, TCSANOW, &rawSettings);
+    writeAll(ENTER_SCREEN, sizeof(ENTER_SCREEN) - 1);
+}
+
+// Повторно посылает сигнал с действием по умолчанию
+void raiseDefault(int signalNumber) {
+    signal(signalNumber, SIG_DFL);
+
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, signalNumber);
+    pthread_sigmask(SIG_UNBLOCK, &mask, nullptr);
+    raise(signalNumber);
+}
+
+void installHandler(int signalNumber, void (*handler)(int)) {
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = handler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(signalNumber, &action, nullptr);
+}
+
+void onTerminateSignal(int signalNumber) {
+    if (sessionActive) restoreTerminal();
+    raiseDefault(signalNumber);
+}
+
+void onSuspendSignal(int signalNumber) {
+    int savedErrno = errno;
+    if (sessionActive) restoreTerminal();
+
+    // Процесс останавливается здесь и продолжает работу после SIGCONT
+    raiseDefault(signalNumber);
+
+    installHandler(signalNumber, onSuspendSignal);
+    if (sessionActive) {
+        resumeTerminal();
+        // Экран после возврата из фона пуст - перерисовываем его как после смены размера
+        raise(SIGWINCH);
+    }
+    errno = savedErrno;
+}
+#endif
+
+} // namespace
+
+TerminalSession::TerminalSession() : active(false) {
+#ifndef _WIN32
+    if (isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &savedSettings) == 0) {
+        // Посимвольный ввод без эха; Ctrl+C и Ctrl+Z по-прежнему работают
+        rawSettings = savedSettings;
+        rawSettings.c_lflag &= ~(ICANON | ECHO);
+        rawSettings.c_cc[VMIN] = 1;
+        rawSettings.c_cc[VTIME] = 0;
+
+        if (tcsetattr(STDIN_FILENO, TCSANOW, &rawSettings) == 0) {
+            active = true;
+            sessionActive = 1;
+            for (int signalNumber : TERMINATING_SIGNALS) {
+                installHandler(signalNumber, onTerminateSignal);
+            }
+            installHandler(SIGTSTP, onSuspendSignal);
+        }
+    }
+#endif
+    PlatformUtils::enterAlternateScreen();
+}
+
+TerminalSession::~TerminalSession() {
+    PlatformUtils::leaveAlternateScreen();
+#ifndef _WIN32
+    if (active) {
+        sessionActive = 0;
+        tcsetattr(STDIN_FILENO, TCSANOW, &savedSettings);
+        for (int signalNumber : TERMINATING_SIGNALS) {
+            signal(signalNumber, SIG_DFL);
+        }
+        signal(SIGTSTP, SIG_DFL);
+    }
+#endif
+}
+
+bool TerminalSession::isActive() const {
+    return active;
+}
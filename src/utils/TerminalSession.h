@@ -0,0 +1,51 @@
+/**
+ * @file TerminalSession.h
+ * @author Vld251
+ * @brief RAII guard keeping the terminal in raw mode for the whole game.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef TERMINALSESSION_H
+#define TERMINALSESSION_H
+
+/**
+ * @brief Switches the terminal to raw mode and the alternate screen for its lifetime.
+ * 
+ * Raw mode (no line buffering, no echo) is entered once instead of around
+ * every key read. The original settings are restored by the destructor and
+ * also when the process is interrupted or terminated by a signal; on
+ * suspend (Ctrl+Z) the terminal is restored and raw mode resumes after the
+ * game is continued. Only one session may exist at a time.
+ */
+class TerminalSession {
+private:
+    bool active;    ///< Whether this object changed terminal settings
+
+public:
+    /**
+     * @brief Enters raw mode and the alternate screen, installs restoring signal handlers.
+     * @returns None
+     */
+    TerminalSession();
+
+    /**
+     * @brief Restores terminal settings and the main screen.
+     * @returns None
+     */
+    ~TerminalSession();
+
+    TerminalSession(const TerminalSession&) = delete;
+    TerminalSession& operator=(const TerminalSession&) = delete;
+
+    /**
+     * @brief Checks if raw mode was entered.
+     * @return true if standard input is a terminal now in raw mode, false otherwise.
+     */
+    bool isActive() const;
+};
+
+#endif // TERMINALSESSION_H
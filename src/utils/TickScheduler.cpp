@@ -0,0 +1,90 @@
+/**
+ * @file TickScheduler.cpp
+ * @author Vld251
+ * @brief Implementation of the drift-free tick scheduler.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "TickScheduler.h"
+
+#ifdef __linux__
+#include <time.h>
+#include <cerrno>
+#else
+#include <thread>
+#endif
+
+const int TickScheduler::MAX_CATCH_UP;
+
+TickScheduler::TickScheduler()
+    : period(std::chrono::seconds(1)), policy(TickPolicy::SKIP), restartPending(true),
+      skipped(0), latency(nullptr) {}
+
+void TickScheduler::setRate(int ticksPerSecond) {
+    if (ticksPerSecond < 1) ticksPerSecond = 1;
+    period = std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(1000000000LL / ticksPerSecond));
+}
+
+void TickScheduler::setPolicy(TickPolicy missed) {
+    policy = missed;
+}
+
+void TickScheduler::setLatencyStats(LatencyStats* stats) {
+    latency = stats;
+}
+
+void TickScheduler::restart() {
+    restartPending = true;
+}
+
+TickScheduler::Clock::time_point TickScheduler::getDeadline() {
+    if (restartPending) {
+        deadline = Clock::now() + period;
+        restartPending = false;
+    }
+    return deadline;
+}
+
+void TickScheduler::sleepUntilDeadline() const {
+#ifdef __linux__
+    // steady_clock в libstdc++ и libc++ - это CLOCK_MONOTONIC
+    long long nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+    struct timespec until;
+    until.tv_sec = static_cast<time_t>(nanos / 1000000000LL);
+    until.tv_nsec = static_cast<long>(nanos % 1000000000LL);
+
+    // Абсолютный срок: прерывание сигналом не сдвигает момент пробуждения
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, nullptr) == EINTR) {}
+#else
+    std::this_thread::sleep_until(deadline);
+#endif
+}
+
+int TickScheduler::beginTick() {
+    getDeadline();
+    Clock::time_point now = Clock::now();
+    Clock::duration late = now > deadline ? now - deadline : Clock::duration::zero();
+    if (latency) {
+        latency->record(LatencyStage::TICK_JITTER, late);
+    }
+
+    // Сроки пропущенных тиков (кроме текущего) - догоняем или пропускаем по политике
+    long long missed = late / period;
+    long long extra = 0;
+    if (policy == TickPolicy::CATCH_UP) {
+        extra = missed < MAX_CATCH_UP - 1 ? missed : MAX_CATCH_UP - 1;
+    }
+    skipped += static_cast<unsigned long>(missed - extra);
+
+    // Следующий срок - от прошлого срока, а не от текущего момента: расписание не уплывает
+    deadline += period * (missed + 1);
+    return static_cast<int>(1 + extra);
+}
+
+unsigned long TickScheduler::getSkippedTicks() const {
+    return skipped;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file TickScheduler.h
+ * @author Vld251
+ * @brief Fixed-rate tick deadlines on the monotonic clock.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef TICKSCHEDULER_H
+#define TICKSCHEDULER_H
+
+#include "LatencyStats.h"
+
+#include <chrono>
+
+/**
+ * @brief What to do with ticks whose deadlines passed while the game was busy.
+ */
+enum class TickPolicy {
+    SKIP,       ///< Run one tick and drop the missed ones
+    CATCH_UP    ///< Run missed ticks back to back (at most TickScheduler::MAX_CATCH_UP)
+};
+
+/**
+ * @brief Produces tick deadlines at a fixed rate without drift.
+ * 
+ * Deadlines are absolute points on the monotonic clock, each one period
+ * after the previous deadline rather than after the moment a tick actually
+ * ran, so late ticks do not shift the schedule. The final wait uses an
+ * absolute-deadline sleep (clock_nanosleep with TIMER_ABSTIME on Linux).
+ * How late each tick starts is recorded as tick jitter.
+ */
+class TickScheduler {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    static const int MAX_CATCH_UP = 4;  ///< Most ticks run back to back under CATCH_UP
+
+private:
+    Clock::duration period;     ///< Time between ticks
+    Clock::time_point deadline; ///< Deadline of the next tick
+    TickPolicy policy;          ///< Handling of missed ticks
+    bool restartPending;        ///< Next deadline is counted from the next getDeadline() call
+    unsigned long skipped;      ///< Ticks dropped because they were missed
+    LatencyStats* latency;      ///< Where tick jitter goes (not owned), may be null
+
+public:
+    /**
+     * @brief Constructs a scheduler at 1 tick per second with SKIP policy.
+     * @returns None
+     */
+    TickScheduler();
+
+    /**
+     * @brief Sets tick rate; takes effect from the next deadline.
+     * @param ticksPerSecond Ticks per second, at least 1.
+     * @returns None
+     */
+    void setRate(int ticksPerSecond);
+
+    /**
+     * @brief Sets handling of missed ticks.
+     * @param missed Policy.
+     * @returns None
+     */
+    void setPolicy(TickPolicy missed);
+
+    /**
+     * @brief Attaches statistics receiving tick jitter.
+     * @param stats Statistics (not owned), or nullptr.
+     * @returns None
+     */
+    void setLatencyStats(LatencyStats* stats);
+
+    /**
+     * @brief Starts the schedule anew one period after the next getDeadline() call.
+     *
+     * Used after pauses and menus, which are not missed ticks.
+     * @returns None
+     */
+    void restart();
+
+    /**
+     * @brief Gets deadline of the next tick.
+     * @return Absolute deadline.
+     */
+    Clock::time_point getDeadline();
+
+    /**
+     * @brief Sleeps until the deadline of the next tick, returns at once if it passed.
+     * @returns None
+     */
+    void sleepUntilDeadline() const;
+
+    /**
+     * @brief Records the tick starting now and moves to the next deadline.
+     * @return Number of ticks to simulate now: 1, or more when catching up.
+     */
+    int beginTick();
+
+    /**
+     * @brief Gets number of ticks dropped so far.
+     * @return Skipped tick count.
+     */
+    unsigned long getSkippedTicks() const;
+};
+
+#endif // TICKSCHEDULER_H
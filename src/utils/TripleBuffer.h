@@ -0,0 +1,81 @@
+/**
+ * @file TripleBuffer.h
+ * @author Vld251
+ * @brief Lock-free single-producer single-consumer triple buffer.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <atomic>
+
+/**
+ * @brief Hands the newest value from one writer thread to one reader thread.
+ * 
+ * The writer fills its own slot and swaps it with the shared middle slot;
+ * the reader takes the middle slot only if it holds something new. Neither
+ * side ever waits for the other, and slots are reused, so after warm-up
+ * no allocations happen for types like std::vector.
+ */
+template <typename T>
+class TripleBuffer {
+private:
+    static const int INDEX_MASK = 3;  ///< Bits holding slot index
+    static const int FRESH = 4;       ///< Set when middle slot holds an unread value
+
+    T slots[3];                ///< Storage for write, middle and read slots
+    std::atomic<int> middle;   ///< Middle slot index and FRESH flag
+    int writeIndex;            ///< Slot owned by the writer
+    int readIndex;             ///< Slot owned by the reader
+
+public:
+    /**
+     * @brief Constructs a triple buffer with default-constructed slots.
+     * @returns None
+     */
+    TripleBuffer() : middle(1), writeIndex(0), readIndex(2) {}
+
+    /**
+     * @brief Gets slot to fill (writer thread only).
+     * @return Reference to writer slot.
+     */
+    T& writeBuffer() { return slots[writeIndex]; }
+
+    /**
+     * @brief Makes the filled writer slot available to the reader (writer thread only).
+     * 
+     * An unread previous value is dropped - the reader only wants the newest.
+     * @returns None
+     */
+    void publish() {
+        int previous = middle.exchange(writeIndex | FRESH, std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Takes the newest published value, if any (reader thread only).
+     * @return true if readBuffer now holds a value not seen before.
+     */
+    bool update() {
+        if (!(middle.load(std::memory_order_acquire) & FRESH)) {
+            return false;
+        }
+        // Только писатель меняет middle, и всегда ставит FRESH - обмен безопасен
+        int previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Gets last value taken by update (reader thread only).
+     * @return Const reference to reader slot.
+     */
+    const T& readBuffer() const { return slots[readIndex]; }
+};
+
+#endif // TRIPLEBUFFER_H
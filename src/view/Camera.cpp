@@ -0,0 +1,74 @@
+/**
+ * @file Camera.cpp
+ * @author Vld251
+ * @brief Implementation of the deadzone-following camera.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "Camera.h"
+#include <algorithm>
+
+Camera::Camera()
+    : x(0), y(0), width(0), height(0), fieldWidth(0), fieldHeight(0) {}
+
+void Camera::resize(int viewWidth, int viewHeight, int worldWidth, int worldHeight) {
+    fieldWidth = worldWidth;
+    fieldHeight = worldHeight;
+    width = std::max(1, std::min(viewWidth, worldWidth));
+    height = std::max(1, std::min(viewHeight, worldHeight));
+    clamp();
+}
+
+void Camera::follow(const Point& target) {
+    bool visible = target.x >= x && target.x < x + width &&
+                   target.y >= y && target.y < y + height;
+    if (!visible) {
+        x = target.x - width / 2;
+        y = target.y - height / 2;
+        clamp();
+        return;
+    }
+
+    // Мертвая зона - центральная половина окна по каждой оси
+    int marginX = width / 4;
+    int marginY = height / 4;
+
+    if (target.x < x + marginX) {
+        x = target.x - marginX;
+    } else if (target.x > x + width - 1 - marginX) {
+        x = target.x - (width - 1 - marginX);
+    }
+
+    if (target.y < y + marginY) {
+        y = target.y - marginY;
+    } else if (target.y > y + height - 1 - marginY) {
+        y = target.y - (height - 1 - marginY);
+    }
+
+    clamp();
+}
+
+void Camera::clamp() {
+    x = std::max(0, std::min(x, fieldWidth - width));
+    y = std::max(0, std::min(y, fieldHeight - height));
+}
+
+int Camera::getX() const {
+    return x;
+}
+
+int Camera::getY() const {
+    return y;
+}
+
+int Camera::getWidth() const {
+    return width;
+}
+
+int Camera::getHeight() const {
+    return height;
+}
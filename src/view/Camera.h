@@ -0,0 +1,87 @@
+/**
+ * @file Camera.h
+ * @author Vld251
+ * @brief Viewport over the game field that follows the player with a deadzone.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include "../model/GameObject.h"
+
+/**
+ * @brief Window of the field shown on screen.
+ * 
+ * The camera stays still while the target moves inside the central
+ * deadzone and scrolls only when the target leaves it, so small moves do
+ * not shift the whole picture. The window never leaves the field.
+ */
+class Camera {
+private:
+    int x;              ///< Field column of the left edge
+    int y;              ///< Field row of the top edge
+    int width;          ///< Window width in cells
+    int height;         ///< Window height in cells
+    int fieldWidth;     ///< Width of the followed field
+    int fieldHeight;    ///< Height of the followed field
+
+    void clamp(); ///< Keeps window inside the field
+
+public:
+    /**
+     * @brief Constructs a camera with an empty window.
+     * @returns None
+     */
+    Camera();
+
+    /**
+     * @brief Sets window size, shrinking it to the field if needed.
+     * @param viewWidth Available width in cells.
+     * @param viewHeight Available height in cells.
+     * @param worldWidth Field width.
+     * @param worldHeight Field height.
+     * @returns None
+     */
+    void resize(int viewWidth, int viewHeight, int worldWidth, int worldHeight);
+
+    /**
+     * @brief Scrolls window so that target stays inside the deadzone.
+     * 
+     * If the target is outside the window entirely (new level, respawn),
+     * the window is centered on it instead.
+     * @param target Followed position.
+     * @returns None
+     */
+    void follow(const Point& target);
+
+    /**
+     * @brief Gets field column of the left edge.
+     * @return Column index.
+     */
+    int getX() const;
+
+    /**
+     * @brief Gets field row of the top edge.
+     * @return Row index.
+     */
+    int getY() const;
+
+    /**
+     * @brief Gets window width.
+     * @return Width in cells.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Gets window height.
+     * @return Height in cells.
+     */
+    int getHeight() const;
+};
+
+#endif // CAMERA_H
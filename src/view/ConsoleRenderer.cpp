@@ -14,19 +14,64 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <chrono>
+#include <algorithm>
 
 ConsoleRenderer::ConsoleRenderer() 
-    : screenWidth(40), screenHeight(20), terminalSizeValid(true),
-    useAdvancedGraphics(true) {
+    : screenWidth(40), screenHeight(20), terminalWidth(0), terminalHeight(0),
+    resizeGeneration(0), terminalSizeValid(true),
+    themes(GlyphTheme::loadAll("../resources/themes")), themeIndex(0),
+    frontFlash(false), frontColors(true), frontTheme(-1),
+    frontOffset(0), frameRows(0), legendRows(0), frameValid(false),
+    debugOverlay(false), latencyStats(nullptr), sink(&terminalSink) {
     updateTerminalSize();
 }
 
+const int ConsoleRenderer::FRAME_EXTRA_COLUMNS;
+const int ConsoleRenderer::FRAME_EXTRA_ROWS;
+
+std::pair<int, int> ConsoleRenderer::getFieldCapacity(const std::pair<int, int>& terminalSize) {
+    return { std::max(1, terminalSize.first - FRAME_EXTRA_COLUMNS),
+             std::max(1, terminalSize.second - FRAME_EXTRA_ROWS) };
+}
+
 void ConsoleRenderer::setAdvancedGraphics(bool enabled) {
-    useAdvancedGraphics = enabled;
+    // Встроенные темы всегда на своих местах в начале списка
+    themeIndex = enabled ? GlyphTheme::ADVANCED_INDEX : GlyphTheme::ASCII_INDEX;
 }
 
 bool ConsoleRenderer::getAdvancedGraphics() const {
-    return useAdvancedGraphics;
+    return themeIndex == GlyphTheme::ADVANCED_INDEX;
+}
+
+bool ConsoleRenderer::setTheme(const std::string& name) {
+    for (size_t i = 0; i < themes.size(); i++) {
+        if (themes[i].getName() == name) {
+            themeIndex = static_cast<int>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ConsoleRenderer::nextTheme() {
+    themeIndex = (themeIndex + 1) % static_cast<int>(themes.size());
+}
+
+const std::string& ConsoleRenderer::getThemeName() const {
+    return themes[themeIndex].getName();
+}
+
+int ConsoleRenderer::getActiveThemeIndex() const {
+    // Unicode-тема на терминале без Unicode заменяется встроенной ASCII
+    if (themes[themeIndex].needsUnicode() && !PlatformUtils::supportsUnicode()) {
+        return GlyphTheme::ASCII_INDEX;
+    }
+    return themeIndex;
+}
+
+const GlyphTheme& ConsoleRenderer::getActiveTheme() const {
+    return themes[getActiveThemeIndex()];
 }
 
 bool ConsoleRenderer::isTerminalSizeValid() const {
@@ -34,7 +79,15 @@ bool ConsoleRenderer::isTerminalSizeValid() const {
 }
 
 void ConsoleRenderer::updateTerminalSize() {
-    auto size = PlatformUtils::getTerminalSize();
+    auto size = sink->getSize();
+
+    // Раскладка кадра меняется при смене размера; SIGWINCH без смены размера
+    // (например, после возврата из фона) тоже означает, что экран надо нарисовать заново
+    unsigned generation = PlatformUtils::getResizeGeneration();
+    if (size.first != terminalWidth || size.second != terminalHeight || generation != resizeGeneration) {
+        frameValid = false;
+    }
+    resizeGeneration = generation;
     terminalWidth = size.first;
     terminalHeight = size.second;
     
@@ -90,6 +143,35 @@ void ConsoleRenderer::drawBorder() {
 
 void ConsoleRenderer::clearScreen() {
     PlatformUtils::clearScreen();
+    frameValid = false;
+}
+
+void ConsoleRenderer::invalidateFrame() {
+    frameValid = false;
+}
+
+void ConsoleRenderer::setDebugOverlay(bool enabled) {
+    debugOverlay = enabled;
+    frameValid = false;
+}
+
+void ConsoleRenderer::setLatencyStats(const LatencyStats* stats) {
+    latencyStats = stats;
+    frameValid = false;
+}
+
+void ConsoleRenderer::setSink(RenderSink* output) {
+    sink = output ? output : &terminalSink;
+    frameValid = false;
+    updateTerminalSize();
+}
+
+RenderSink* ConsoleRenderer::getSink() const {
+    return sink;
+}
+
+int ConsoleRenderer::getFrameInterval() const {
+    return pacer.getFrameInterval();
 }
 
 void ConsoleRenderer::setCursorPosition(int x, int y) {
@@ -121,232 +203,214 @@ void ConsoleRenderer::drawErrorMessage(const std::string& message) {
     }
 }
 
-std::map<char, std::pair<std::string, PlatformUtils::Color>> getGraphicsMap(bool useUnicode, bool useAdvancedGraphics) {
-    if (useUnicode && useAdvancedGraphics) {
-        // Unicode символы
-        return {
-            {'^', {"▲", PlatformUtils::Color::GREEN}},
-            {'v', {"▼", PlatformUtils::Color::GREEN}},
-            {'<', {"◄", PlatformUtils::Color::GREEN}},
-            {'>', {"►", PlatformUtils::Color::GREEN}},
-        
-            {'A', {"A", PlatformUtils::Color::RED}},
-            {'E', {"E", PlatformUtils::Color::RED}},
-            {'F', {"F", PlatformUtils::Color::RED}},
-            {'D', {"D", PlatformUtils::Color::RED}},
-        
-            {'S', {"★", PlatformUtils::Color::MAGENTA}},
-            {'K', {"¶", PlatformUtils::Color::MAGENTA}},
-            {'B', {"➤", PlatformUtils::Color::MAGENTA}},
-            {'L', {"❤", PlatformUtils::Color::MAGENTA}},
-        
-            {'#', {"█", PlatformUtils::Color::DEFAULT}},
-            {'X', {"▓", PlatformUtils::Color::DEFAULT}},
-            
-            {'~', {"░", PlatformUtils::Color::BLUE}},
-            {'*', {"§", PlatformUtils::Color::GREEN}},
-            
-            {'O', {"●", PlatformUtils::Color::YELLOW}},
-            {' ', {" ", PlatformUtils::Color::DEFAULT}}
-        };
-    } else {
-        // ASCII фолбэк
-        return {
-            {'^', {"^", PlatformUtils::Color::GREEN}},
-            {'v', {"v", PlatformUtils::Color::GREEN}},
-            {'<', {"<", PlatformUtils::Color::GREEN}},
-            {'>', {">", PlatformUtils::Color::GREEN}},
-
-            {'A', {"A", PlatformUtils::Color::RED}},
-            {'E', {"E", PlatformUtils::Color::RED}},
-            {'F', {"F", PlatformUtils::Color::RED}},
-            {'D', {"D", PlatformUtils::Color::RED}},
-            
-            {'S', {"S", PlatformUtils::Color::MAGENTA}},
-            {'K', {"K", PlatformUtils::Color::MAGENTA}},
-            {'B', {"B", PlatformUtils::Color::MAGENTA}},
-            {'L', {"L", PlatformUtils::Color::MAGENTA}},
-            
-            {'|', {"|", PlatformUtils::Color::WHITE}},
-            {'-', {"-", PlatformUtils::Color::WHITE}},
-            
-            {'#', {"#", PlatformUtils::Color::DEFAULT}},
-            {'X', {"X", PlatformUtils::Color::DEFAULT}},
-            
-            {'~', {"~", PlatformUtils::Color::BLUE}},
-            {'*', {"*", PlatformUtils::Color::GREEN}},
-            
-            {'O', {"@", PlatformUtils::Color::YELLOW}},
-            {' ', {" ", PlatformUtils::Color::DEFAULT}}
-        };
-    }
-}
-
-bool ConsoleRenderer::render(const GameWorld& world) {
+bool ConsoleRenderer::render(const RenderSnapshot& snapshot) {
     if (!checkTerminalSize()) {
         drawErrorMessage("Размер терминала слишком мал для отображения игры");
         return false;
     }
 
-    bool damageFlashActive = world.isDamageFlashActive();
-    bool useUnicode = PlatformUtils::supportsUnicode();
-    auto graphicsMap = getGraphicsMap(useUnicode, useAdvancedGraphics);
+    // Размер поля берется из снимка; при его смене кадр рисуется заново
+    bool sizeChanged = snapshot.width != screenWidth || snapshot.height != screenHeight;
+    screenWidth = snapshot.width;
+    screenHeight = snapshot.height;
 
     // Рассчитываем отступ для центрирования игрового поля
     int gameFieldWidth = screenWidth + 4; // +4 для границ (██ с двух сторон)
     int horizontalOffset = calculateHorizontalOffset(gameFieldWidth);
 
-    // Очищаем экран
-    clearScreen();
+    std::string statusLine = buildStatusLine(snapshot);
+    std::string bonusLine = buildBonusLine(snapshot);
 
-    // Выводим верхнюю информацию о статусе игры
-    std::string statusLine = "Level: " + std::to_string(world.getCurrentLevel()) 
-                           + " | Score: " + std::to_string(world.getPlayer()->getScore())
-                           + " | Lives: " + std::to_string(world.getPlayer()->getLives())
-                           + " | Health: " + std::to_string(world.getPlayer()->getHealth());
-    
-    // Центрируем строку статуса
-    int statusOffset = calculateHorizontalOffset(statusLine.length());
-    std::cout << std::string(statusOffset, ' ') << statusLine << "\n\n";
-    
-    // Рисуем верхнюю границу с отступом
-    setColor(PlatformUtils::Color::BLACK);
-    if (damageFlashActive) {
-        setColor(PlatformUtils::Color::RED);
+    // Терминал не успевает - включение вспышки рамки не стоит полной перерисовки,
+    // но погасить её нужно всегда, иначе рамка так и останется красной
+    bool flash = snapshot.damageFlash;
+    if (pacer.diffOnly() && frameValid) {
+        flash = flash && frontFlash;
     }
-    std::cout << std::string(horizontalOffset, ' ');
-    drawBorder();
-    resetColor();
-    
-    // Создаем буфер для отрисовки
-    std::vector<std::vector<char>> buffer(screenHeight, std::vector<char>(screenWidth, ' '));
-    
-    // Заполняем буфер объектами (существующий код без изменений)
-    for (const auto& obj : world.getObjects()) {
-        if (obj->isDestroyed()) continue;
-        
-        Point pos = obj->getPosition();
-        Point bounds = obj->getBounds();
-        char symbol = obj->getSymbol();
-        
-        for (int y = 0; y < bounds.y; y++) {
-            for (int x = 0; x < bounds.x; x++) {
-                int drawX = pos.x + x;
-                int drawY = pos.y + y;
-                
-                if (drawX >= 0 && drawX < screenWidth && 
-                    drawY >= 0 && drawY < screenHeight) {
-                    buffer[drawY][drawX] = symbol;
-                }
-            }
-        }
+    bool colors = pacer.colorEnabled();
+
+    // Полная перерисовка нужна, если экран менялся или поменялись рамка/режим графики
+    bool fullRedraw = !frameValid || sizeChanged || flash != frontFlash ||
+                      horizontalOffset != frontOffset ||
+                      getActiveThemeIndex() != frontTheme || colors != frontColors;
+
+    // Весь кадр кодируется в один буфер и уходит на терминал одной записью
+    encoder.begin();
+    encoder.setColorEnabled(colors);
+    if (fullRedraw) {
+        drawFullFrame(snapshot.cells, statusLine, bonusLine, flash, horizontalOffset);
+    } else {
+        drawFrameDiff(snapshot.cells, statusLine, bonusLine, horizontalOffset);
     }
-    
-    // Рисуем снаряды
-    for (const auto& proj : world.getProjectiles()) {
-        if (proj->isDestroyed()) continue;
-        
-        Point pos = proj->getPosition();
-        if (pos.x >= 0 && pos.x < screenWidth && 
-            pos.y >= 0 && pos.y < screenHeight) {
-            buffer[pos.y][pos.x] = proj->getSymbol();
+    if (debugOverlay) {
+        // Строка отладки под легендой: режим вывода и измеренная скорость
+        std::string overlay = pacer.describe();
+        if (fullRedraw || overlay != frontOverlay) {
+            redrawLine(frameRows, overlay);
+            encoder.moveCursor(0, frameRows + 2);
         }
-    }
-    
-    // Рисуем бонусы
-    for (const auto& bonus : world.getBonuses()) {
-        if (!bonus->isActive()) continue;
-        
-        Point pos = bonus->getPosition();
-        if (pos.x >= 0 && pos.x < screenWidth && 
-            pos.y >= 0 && pos.y < screenHeight) {
-            buffer[pos.y][pos.x] = bonus->getSymbol();
+        frontOverlay = overlay;
+
+        // Вторая строка: задержка от нажатия клавиши до кадра и её составляющие
+        std::string latency = latencyStats ? latencyStats->describe() : std::string();
+        if (fullRedraw || latency != frontLatency) {
+            redrawLine(frameRows + 1, latency);
+            encoder.moveCursor(0, frameRows + 2);
         }
+        frontLatency = latency;
     }
+    encoder.resetColor();
+
+    // Время записи показывает, успевает ли терминал принимать кадры
+    size_t frameBytes = encoder.size();
+    std::chrono::steady_clock::time_point writeStart = std::chrono::steady_clock::now();
+    encoder.flush(*sink);
+    pacer.recordFrame(frameBytes, std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - writeStart).count());
+
+    // Показанный кадр становится эталоном для следующего сравнения
+    frontBuffer.assign(snapshot.cells.begin(), snapshot.cells.end());
+    frontStatus = statusLine;
+    frontBonus = bonusLine;
+    frontFlash = flash;
+    frontColors = colors;
+    frontOffset = horizontalOffset;
+    frontTheme = getActiveThemeIndex();
+    frameValid = true;
 
-    // Рисуем взрывы
-    for (const auto& explosion : world.getExplosions()) {
-        if (explosion->isDestroyed()) continue;
-        
-        Point pos = explosion->getPosition();
-        if (pos.x >= 0 && pos.x < screenWidth && 
-            pos.y >= 0 && pos.y < screenHeight) {
-            buffer[pos.y][pos.x] = explosion->getSymbol();
-        }
+    return true;
+}
+
+std::string ConsoleRenderer::buildStatusLine(const RenderSnapshot& snapshot) const {
+    return "Level: " + std::to_string(snapshot.level) 
+         + " | Score: " + std::to_string(snapshot.score)
+         + " | Lives: " + std::to_string(snapshot.lives)
+         + " | Health: " + std::to_string(snapshot.health);
+}
+
+std::string ConsoleRenderer::buildBonusLine(const RenderSnapshot& snapshot) const {
+    if (!snapshot.hasPlayer) return "";
+
+    std::string bonusLine = "Bonuses: ";
+    if (snapshot.hasShield) { 
+        bonusLine += "[★ Shield] ";
+    }
+    if (snapshot.doubleFire) { 
+        bonusLine += "[¶ Double Fire] ";
     }
+    if (snapshot.bonusDuration > 0) { 
+        bonusLine += "(turns left: " + std::to_string(snapshot.bonusDuration) + ")";
+    }
+    return bonusLine;
+}
+
+void ConsoleRenderer::drawFullFrame(const std::vector<char>& cells, const std::string& status,
+                                    const std::string& bonus, bool flash, int offset) {
+    const GlyphTheme& theme = getActiveTheme();
+    PlatformUtils::Color borderColor = flash ? PlatformUtils::Color::RED : PlatformUtils::Color::BLACK;
+
+    encoder.clearScreen();
+
+    // Центрируем строку статуса
+    encoder.appendSpaces(calculateHorizontalOffset(status.length()));
+    encoder.append(status);
+    encoder.append("\n\n", 2);
+    
+    // Рисуем верхнюю границу с отступом
+    encoder.appendSpaces(offset);
+    encodeBorder(borderColor);
     
     // Выводим буфер на экран с центрированием
     for (int y = 0; y < screenHeight; y++) {
-        // Добавляем отступ для центрирования
-        std::cout << std::string(horizontalOffset, ' ');
+        encoder.appendSpaces(offset);
         
-        setColor(PlatformUtils::Color::BLACK);
-        if (damageFlashActive) {
-            setColor(PlatformUtils::Color::RED);
-        }
-        std::cout << "██"; // Левая граница
-        resetColor();
+        encoder.setColor(borderColor);
+        encoder.append("██"); // Левая граница
         
-        for (int x = 0; x < screenWidth; x++) { 
-            char symbol = buffer[y][x];
-            
-            // Используем графическую карту для улучшенного отображения
-            auto it = graphicsMap.find(symbol);
-            if (it != graphicsMap.end()) {
-                setColor(it->second.second);
-                std::cout << it->second.first;
-            } else {
-                // Для неизвестных символов используем стандартное отображение
-                std::cout << symbol;
-            }
-            
-            resetColor();
-        }
+        encoder.appendRow(&cells[y * screenWidth], screenWidth, theme);
 
-        setColor(PlatformUtils::Color::BLACK);
-        if (damageFlashActive) {
-            setColor(PlatformUtils::Color::RED);
-        }
-        std::cout << "██\n"; // Правая граница
-        resetColor();
+        encoder.setColor(borderColor);
+        encoder.append("██\n"); // Правая граница
     }
     
     // Рисуем нижнюю границу с отступом
-    setColor(PlatformUtils::Color::BLACK);
-    if (damageFlashActive) {
-        setColor(PlatformUtils::Color::RED);
-    }
-    std::cout << std::string(horizontalOffset, ' ');
-    drawBorder();
-    resetColor();
+    encoder.appendSpaces(offset);
+    encodeBorder(borderColor);
+    encoder.resetColor();
     
     // Отображаем статус бонусов игрока
-    PlayerTank* player = world.getPlayer();
-    if (player) {
-        std::string bonusLine = "Bonuses: ";
-        if (player->getHasShield()) { 
-            bonusLine += "[★ Shield] ";
-        }
-        if (player->getDoubleFire()) { 
-            bonusLine += "[¶ Double Fire] ";
-        }
-        if (player->getBonusDuration() > 0) { 
-            bonusLine += "(turns left: " + std::to_string(player->getBonusDuration()) + ")";
+    encoder.appendSpaces(calculateHorizontalOffset(bonus.length()));
+    encoder.append(bonus);
+    encoder.append('\n');
+    
+    encodeSymbolLegend();
+
+    // Статус, пустая строка, две границы, строка бонусов, поле и легенда
+    frameRows = 5 + screenHeight + legendRows;
+}
+
+void ConsoleRenderer::drawFrameDiff(const std::vector<char>& cells, const std::string& status,
+                                    const std::string& bonus, int offset) {
+    const GlyphTheme& theme = getActiveTheme();
+
+    if (status != frontStatus) {
+        redrawLine(0, status);
+    }
+
+    // Поле начинается под статусом, пустой строкой и верхней границей
+    const int fieldRow = 3;
+    for (int y = 0; y < screenHeight; y++) {
+        const char* front = &frontBuffer[y * screenWidth];
+        const char* back = &cells[y * screenWidth];
+
+        int x = 0;
+        while (x < screenWidth) {
+            if (front[x] == back[x]) {
+                x++;
+                continue;
+            }
+
+            // Одно перемещение курсора на весь отрезок изменившихся клеток
+            int start = x;
+            while (x < screenWidth && front[x] != back[x]) {
+                x++;
+            }
+            encoder.moveCursor(offset + 2 + start, fieldRow + y);
+            encoder.appendRow(back + start, x - start, theme);
         }
-        
-        // Центрируем строку бонусов
-        int bonusOffset = calculateHorizontalOffset(bonusLine.length());
-        std::cout << std::string(bonusOffset, ' ') << bonusLine << "\n";
     }
-    
-    drawSymbolLegend();
 
-    return true;
+    if (bonus != frontBonus) {
+        redrawLine(fieldRow + screenHeight + 1, bonus);
+    }
+
+    // Возвращаем курсор под кадр
+    encoder.moveCursor(0, frameRows);
+}
+
+void ConsoleRenderer::redrawLine(int row, const std::string& text) {
+    encoder.moveCursor(0, row);
+    encoder.resetColor();
+    encoder.clearLine(); // Стираем строку целиком
+    encoder.appendSpaces(calculateHorizontalOffset(text.length()));
+    encoder.append(text);
+}
+
+void ConsoleRenderer::encodeBorder(PlatformUtils::Color color) {
+    encoder.setColor(color);
+    encoder.append("██");
+    for (int i = 0; i < screenWidth; i++) { encoder.append("█"); }
+    encoder.append("██\n");
 }
 
 void ConsoleRenderer::drawSymbolLegend() {
-    bool useUnicode = PlatformUtils::supportsUnicode();
-    auto graphicsMap = getGraphicsMap(useUnicode, useAdvancedGraphics);
+    encoder.begin();
+    encodeSymbolLegend();
+    encoder.flush(*sink);
+}
+
+void ConsoleRenderer::encodeSymbolLegend() {
+    const GlyphTheme& theme = getActiveTheme();
     
     // Создаем вектор строк для легенды
     std::vector<std::string> legendLines = {
@@ -354,26 +418,28 @@ void ConsoleRenderer::drawSymbolLegend() {
         "",
         "Tanks:",
         "",
-        "  Player: " + graphicsMap.find('^')->second.first + " " + 
-                    graphicsMap.find('v')->second.first + " " + 
-                    graphicsMap.find('<')->second.first + " " + 
-                    graphicsMap.find('>')->second.first,
+        "  Player: " + theme.getText('^') + " " + 
+                    theme.getText('v') + " " + 
+                    theme.getText('<') + " " + 
+                    theme.getText('>'),
         "",
-        "  Enemies:  " + graphicsMap.find('E')->second.first + " - normal" + "  " + graphicsMap.find('F')->second.first + " - fast" + "  " + graphicsMap.find('D')->second.first + " - strong" + "  " + graphicsMap.find('A')->second.first + " - armored",
+        "  Enemies:  " + theme.getText('E') + " - normal" + "  " + theme.getText('F') + " - fast" + "  " + theme.getText('D') + " - strong" + "  " + theme.getText('A') + " - armored",
         "",
-        "Obstacles:  " + graphicsMap.find('#')->second.first + " - brick" + "  " + graphicsMap.find('X')->second.first + " - steel" + "  " + graphicsMap.find('~')->second.first + " - water" + "  " + graphicsMap.find('*')->second.first + " - forest",
+        "Obstacles:  " + theme.getText('#') + " - brick" + "  " + theme.getText('X') + " - steel" + "  " + theme.getText('~') + " - water" + "  " + theme.getText('*') + " - forest",
         "",
-        "Bonuses:  " + graphicsMap.find('S')->second.first + " - shield" + "  " + graphicsMap.find('K')->second.first + " - double fire" + "  " + graphicsMap.find('B')->second.first + " - speed" + "  " + graphicsMap.find('L')->second.first + " - +1 life",
+        "Bonuses:  " + theme.getText('S') + " - shield" + "  " + theme.getText('K') + " - double fire" + "  " + theme.getText('B') + " - speed" + "  " + theme.getText('L') + " - +1 life",
         "",
-        "Explosions:    " + graphicsMap.find('O')->second.first,
+        "Explosions:    " + theme.getText('O'),
         ""
     };
     
     // Выводим каждую строку легенды по центру
     for (const auto& line : legendLines) {
-        int offset = calculateHorizontalOffset(line.length());
-        std::cout << std::string(offset, ' ') << line << "\n";
+        encoder.appendSpaces(calculateHorizontalOffset(line.length()));
+        encoder.append(line);
+        encoder.append('\n');
     }
+    legendRows = static_cast<int>(legendLines.size());
 }
 
 bool ConsoleRenderer::drawMenu() {
@@ -404,6 +470,7 @@ bool ConsoleRenderer::drawMenu() {
         "Movement: WASD or arrow keys",
         "Fire: SPACE or F",
         "Pause: P",
+        "Quick save / load: K / L",
         "Menu: M",
         "Exit: Q",
         ""
@@ -483,7 +550,7 @@ bool ConsoleRenderer::drawGameOver(int score) {
     return true;
 }
 
-bool ConsoleRenderer::drawSettings() {
+bool ConsoleRenderer::drawSettings(bool realtime, int tickRate) {
     if (!checkTerminalSize()) {
         drawErrorMessage("Terminal size too small. Increase window size.");
         return false;
@@ -491,7 +558,8 @@ bool ConsoleRenderer::drawSettings() {
 
     clearScreen();
     
-    bool advancedGraphics = PlatformUtils::supportsUnicode() && useAdvancedGraphics;
+    const GlyphTheme& active = getActiveTheme();
+    bool advancedGraphics = active.needsUnicode();
     
     std::vector<std::string> settingsLines = {
         "=================================",
@@ -506,14 +574,18 @@ bool ConsoleRenderer::drawSettings() {
         "Move Right: D / Right Arrow",
         "Fire: SPACE / F",
         "Pause: P",
+        "Quick save / load: K / L",
         "Menu: M",
         "",
         "Game Settings:",
         "",
-        "Graphics: [" + std::string(advancedGraphics ? "X" : " ") + "] Advanced",
-        "          [" + std::string(!advancedGraphics ? "X" : " ") + "] Symbolic",
+        "Theme: " + active.getName() + " (" + std::to_string(themeIndex + 1) +
+            " of " + std::to_string(themes.size()) + ")",
+        "Game mode: " + (realtime ? "Real-time (" + std::to_string(tickRate) + " ticks/s)" :
+                                    std::string("Turn-based")),
         "",
-        "[F] - Toggle graphics mode",
+        "[F] - Next theme",
+        "[P] - Switch game mode",
         "---------------------------------",
         "Status: " + std::string(advancedGraphics ? 
             "Advanced graphics (Unicode)" : 
@@ -589,43 +661,32 @@ bool ConsoleRenderer::drawMapSelection(const MapInfo& currentMap, int currentInd
 }
 
 void ConsoleRenderer::drawMapPreview(const MapInfo& map) {
-    bool useUnicode = PlatformUtils::supportsUnicode();
-    auto graphicsMap = getGraphicsMap(useUnicode, useAdvancedGraphics);
+    const GlyphTheme& theme = getActiveTheme();
     
+    // Большие карты показываем с прореживанием, чтобы превью влезло в экран
+    const int maxPreviewHeight = 20;
+    int maxPreviewWidth = std::max(1, terminalWidth - FRAME_EXTRA_COLUMNS);
+    int step = std::max((map.width + maxPreviewWidth - 1) / maxPreviewWidth,
+                        (map.height + maxPreviewHeight - 1) / maxPreviewHeight);
+    step = std::max(1, step);
+
     // Рассчитываем отступ для центрирования превью карты
-    int previewWidth = map.width + 4; // +4 для отступов и границ
+    int previewWidth = (map.width + step - 1) / step + 4; // +4 для отступов и границ
     int offset = calculateHorizontalOffset(previewWidth);
     
-    for (int y = 0; y < map.height; y++) {
-        std::cout << std::string(offset, ' ') << "  ";
+    encoder.begin();
+    for (int y = 0; y < map.height; y += step) {
+        encoder.resetColor();
+        encoder.appendSpaces(offset + 2);
         
-        for (int x = 0; x < map.width; x++) {
-            char symbol = map.layout[y][x];
-            
-            // Используем графическую карту для улучшенного отображения
-            auto it = graphicsMap.find(symbol);
-            if (it != graphicsMap.end()) {
-                setColor(it->second.second);
-                std::cout << it->second.first;
-                resetColor();
-            } else {
-                // Для неизвестных символов используем стандартное отображение
-                if (symbol == 'E') {
-                    setColor(PlatformUtils::Color::RED);
-                    std::cout << "E"; // Враги
-                    resetColor();
-                } else if (symbol == '^' || symbol == 'v' || symbol == '<' || symbol == '>') {
-                    setColor(PlatformUtils::Color::GREEN);
-                    std::cout << "P"; // Игрок
-                    resetColor();
-                } else {
-                    std::cout << symbol;
-                }
-            }
+        for (int x = 0; x < map.width; x += step) {
+            encoder.appendGlyph(theme.get(map.layout[y][x]));
         }
-        std::cout << "\n";
+        encoder.resetColor();
+        encoder.append('\n');
     }
-    std::cout << "\n";
+    encoder.append('\n');
+    encoder.flush(*sink);
 }
 
 bool ConsoleRenderer::drawLevelComplete(int score, int level, int lives) {
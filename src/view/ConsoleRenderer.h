@@ -13,8 +13,14 @@
 #define CONSOLERENDERER_H
 
 #include "../model/GameWorld.h"
+#include "../model/RenderSnapshot.h"
 #include "../utils/MapManager.h"
 #include "../utils/PlatformUtils.h"
+#include "../utils/LatencyStats.h"
+#include "FrameEncoder.h"
+#include "GlyphTheme.h"
+#include "OutputPacer.h"
+#include "RenderSink.h"
 #include <iostream>
 #include <string>
 #include <vector>
@@ -31,6 +37,7 @@ private:
     int screenHeight;         ///< Height of game screen in characters
     int terminalWidth;        ///< Actual terminal width
     int terminalHeight;       ///< Actual terminal height
+    unsigned resizeGeneration; ///< Terminal resize generation the screen was laid out for
     bool terminalSizeValid;   ///< Whether terminal meets minimum size requirements
     
     /**
@@ -81,9 +88,109 @@ private:
      */
     void drawMapPreview(const MapInfo& map);
 
-    bool useAdvancedGraphics;  ///< Whether to use advanced Unicode graphics
+    std::vector<GlyphTheme> themes;  ///< Built-in and user themes, compiled at startup
+    int themeIndex;                  ///< Selected theme
+
+    std::vector<char> frontBuffer;  ///< Field cells currently shown on screen
+    std::string frontStatus;        ///< Status line currently shown
+    std::string frontBonus;         ///< Bonus line currently shown
+    bool frontFlash;                ///< Damage flash state of shown borders
+    bool frontColors;               ///< Whether shown frame was drawn with colors
+    int frontTheme;                 ///< Theme index of shown frame
+    int frontOffset;                ///< Horizontal offset of shown frame
+    int frameRows;                  ///< Rows occupied by shown frame
+    int legendRows;                 ///< Lines printed by the last symbol legend
+    bool frameValid;                ///< Whether screen still holds the last game frame
+    FrameEncoder encoder;           ///< Reused byte buffer for one frame
+    OutputPacer pacer;              ///< Write speed measurements and output mode
+    bool debugOverlay;              ///< Whether pacing statistics are shown under the frame
+    std::string frontOverlay;       ///< Debug overlay line currently shown
+    std::string frontLatency;       ///< Latency overlay line currently shown
+    const LatencyStats* latencyStats; ///< Latencies shown in the debug overlay (not owned), may be null
+    TerminalSink terminalSink;      ///< Default output to the terminal
+    RenderSink* sink;               ///< Where game frames are written (not owned)
+
+    /**
+     * @brief Builds status line for the top of the game screen.
+     * @param snapshot Frame snapshot.
+     * @return Status line text.
+     */
+    std::string buildStatusLine(const RenderSnapshot& snapshot) const;
+
+    /**
+     * @brief Builds line with active player bonuses.
+     * @param snapshot Frame snapshot.
+     * @return Bonus line text.
+     */
+    std::string buildBonusLine(const RenderSnapshot& snapshot) const;
+
+    /**
+     * @brief Redraws whole game screen.
+     * @param cells Field cells to draw.
+     * @param status Status line.
+     * @param bonus Bonus line.
+     * @param flash Whether damage flash is active.
+     * @param offset Horizontal offset of the field.
+     * @returns None
+     */
+    void drawFullFrame(const std::vector<char>& cells, const std::string& status,
+                       const std::string& bonus, bool flash, int offset);
+
+    /**
+     * @brief Redraws only cells and lines that differ from the shown frame.
+     * @param cells Field cells to draw.
+     * @param status Status line.
+     * @param bonus Bonus line.
+     * @param offset Horizontal offset of the field.
+     * @returns None
+     */
+    void drawFrameDiff(const std::vector<char>& cells, const std::string& status,
+                       const std::string& bonus, int offset);
+
+    /**
+     * @brief Encodes horizontal border line.
+     * @param color Border color.
+     * @returns None
+     */
+    void encodeBorder(PlatformUtils::Color color);
+
+    /**
+     * @brief Gets index of theme actually used for output.
+     * @return Selected theme, or ASCII theme if terminal lacks Unicode.
+     */
+    int getActiveThemeIndex() const;
+
+    /**
+     * @brief Gets theme actually used for output.
+     * @return Const reference to theme.
+     */
+    const GlyphTheme& getActiveTheme() const;
+
+    /**
+     * @brief Encodes symbol legend lines.
+     * @returns None
+     */
+    void encodeSymbolLegend();
+
+    /**
+     * @brief Replaces one text line of the screen in place.
+     * @param row Screen row.
+     * @param text New line text (centered).
+     * @returns None
+     */
+    void redrawLine(int row, const std::string& text);
 
 public:
+    static const int FRAME_EXTRA_COLUMNS = 4;  ///< Side borders around the field
+    static const int FRAME_EXTRA_ROWS = 20;    ///< Status, borders, bonus line, legend and cursor line
+
+    /**
+     * @brief Calculates how many field cells fit on a terminal.
+     * @param terminalSize Terminal size as (columns, rows).
+     * @return Pair of (width, height) of the largest visible field window.
+     */
+    static std::pair<int, int> getFieldCapacity(const std::pair<int, int>& terminalSize);
+
     /**
      * @brief Constructs a ConsoleRenderer object.
      * @returns None
@@ -105,10 +212,51 @@ public:
     
     /**
      * @brief Clears the terminal screen.
+     * 
+     * Also forgets the shown game frame, so the next render redraws it fully.
      * @returns None
      */
     void clearScreen();
+
+    /**
+     * @brief Forces the next render to redraw the whole game screen.
+     * @returns None
+     */
+    void invalidateFrame();
     
+    /**
+     * @brief Shows or hides pacing statistics under the game frame.
+     * @param enabled Whether overlay should be shown.
+     * @returns None
+     */
+    void setDebugOverlay(bool enabled);
+
+    /**
+     * @brief Sets latency statistics shown on a second debug overlay line.
+     * @param stats Statistics to show (not owned), or nullptr for none.
+     * @returns None
+     */
+    void setLatencyStats(const LatencyStats* stats);
+
+    /**
+     * @brief Redirects game frames and screen size queries to another sink.
+     * @param output Sink to use (not owned), or nullptr for the terminal.
+     * @returns None
+     */
+    void setSink(RenderSink* output);
+
+    /**
+     * @brief Gets sink receiving game frames.
+     * @return Current sink.
+     */
+    RenderSink* getSink() const;
+
+    /**
+     * @brief Gets pause the output pacer wants between game frames.
+     * @return Milliseconds to wait before the next frame (0 if none).
+     */
+    int getFrameInterval() const;
+
     /**
      * @brief Sets cursor position in terminal.
      * @param x X-coordinate (column).
@@ -118,11 +266,14 @@ public:
     void setCursorPosition(int x, int y);
     
     /**
-     * @brief Renders the game world to console.
-     * @param world GameWorld object to render.
+     * @brief Renders a game frame snapshot to console.
+     * 
+     * Called from the render thread while the game is running; other
+     * drawing methods must not be used until that thread is drained.
+     * @param snapshot Snapshot of the game world.
      * @return true if rendering successful, false otherwise.
      */
-    bool render(const GameWorld& world);
+    bool render(const RenderSnapshot& snapshot);
     
     /**
      * @brief Draws symbol legend explaining game symbols.
@@ -151,9 +302,11 @@ public:
     
     /**
      * @brief Draws settings screen.
+     * @param realtime Whether the real-time game mode is selected.
+     * @param tickRate Simulation ticks per second of the real-time mode.
      * @return true if rendering successful, false otherwise.
      */
-    bool drawSettings();
+    bool drawSettings(bool realtime, int tickRate);
     
     /**
      * @brief Draws map selection screen.
@@ -186,6 +339,25 @@ public:
      */
     bool getAdvancedGraphics() const;
 
+    /**
+     * @brief Selects theme by name.
+     * @param name Theme name.
+     * @return true if theme exists, false otherwise.
+     */
+    bool setTheme(const std::string& name);
+
+    /**
+     * @brief Switches to the next available theme.
+     * @returns None
+     */
+    void nextTheme();
+
+    /**
+     * @brief Gets name of selected theme.
+     * @return Theme name.
+     */
+    const std::string& getThemeName() const;
+
     /**
      * @brief Checks if terminal size is valid.
      * @return true if terminal size meets requirements, false otherwise.
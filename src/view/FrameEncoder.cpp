@@ -0,0 +1,254 @@
+/**
+ * @file FrameEncoder.cpp
+ * @author Vld251
+ * @brief Implementation of the single-write terminal frame encoder.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "FrameEncoder.h"
+#include <cstring>
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FRAME_ENCODER_SSSE3
+#include <tmmintrin.h>
+#endif
+
+const size_t FrameEncoder::DEFAULT_CAPACITY;
+
+namespace {
+
+const int BLOCK_CELLS = 16;         // Клеток в одном SIMD-блоке
+const int COLOR_CODE_BYTES = 5;     // Длина кода цвета ESC[3Xm
+
+#ifdef FRAME_ENCODER_SSSE3
+
+bool hasSsse3() {
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+}
+
+// Переводит 16 символов в однобайтовые глифы и цвета. Таблицы темы - 8 строк
+// по 16 байт: старший полубайт символа выбирает строку, младший - байт в ней
+__attribute__((target("ssse3")))
+bool translateBlock(const char* cells, const unsigned char* bytes, const unsigned char* colors,
+                    int previousColor, unsigned char* glyphsOut, unsigned char* colorsOut,
+                    unsigned int& changes) {
+    const __m128i lowMask = _mm_set1_epi8(0x0F);
+    const __m128i symbols = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cells));
+    const __m128i low = _mm_and_si128(symbols, lowMask);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(symbols, 4), lowMask);
+
+    __m128i glyphs = _mm_setzero_si128();
+    __m128i glyphColors = _mm_setzero_si128();
+    const unsigned char first = static_cast<unsigned char>(cells[0]);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(symbols, _mm_set1_epi8(cells[0]))) == 0xFFFF) {
+        // Частый случай - пустой участок поля или сплошная стена
+        if (first >= GlyphTheme::ASCII_SYMBOLS) return false;
+        glyphs = _mm_set1_epi8(static_cast<char>(bytes[first]));
+        glyphColors = _mm_set1_epi8(static_cast<char>(colors[first]));
+    } else {
+        for (int row = 0; row < GlyphTheme::ASCII_SYMBOLS / BLOCK_CELLS; row++) {
+            const __m128i inRow = _mm_cmpeq_epi8(high, _mm_set1_epi8(static_cast<char>(row)));
+            const __m128i rowBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + row * BLOCK_CELLS));
+            const __m128i rowColors = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + row * BLOCK_CELLS));
+            glyphs = _mm_or_si128(glyphs, _mm_and_si128(inRow, _mm_shuffle_epi8(rowBytes, low)));
+            glyphColors = _mm_or_si128(glyphColors, _mm_and_si128(inRow, _mm_shuffle_epi8(rowColors, low)));
+        }
+    }
+
+    // Нулевой байт - многобайтовый глиф или символ вне ASCII
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(glyphs, _mm_setzero_si128())) != 0) return false;
+
+    // Цвет каждой клетки сравниваем с цветом предыдущей (для первой - с текущим)
+    const __m128i previous = _mm_or_si128(_mm_slli_si128(glyphColors, 1),
+                                          _mm_cvtsi32_si128(previousColor & 0xFF));
+    changes = ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(glyphColors, previous))) & 0xFFFF;
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(glyphsOut), glyphs);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(colorsOut), glyphColors);
+    return true;
+}
+
+#else
+
+bool hasSsse3() {
+    return false;
+}
+
+bool translateBlock(const char*, const unsigned char*, const unsigned char*,
+                    int, unsigned char*, unsigned char*, unsigned int&) {
+    return false;
+}
+
+#endif
+
+}
+
+FrameEncoder::FrameEncoder(size_t capacity)
+    : buffer(capacity), length(0), currentColor(-1), colorEnabled(true) {}
+
+void FrameEncoder::begin() {
+    length = 0;
+    currentColor = -1;
+}
+
+void FrameEncoder::reserve(size_t extra) {
+    if (length + extra <= buffer.size()) return;
+
+    // Редкий случай - кадр больше буфера
+    size_t capacity = buffer.size() * 2;
+    while (capacity < length + extra) {
+        capacity *= 2;
+    }
+    buffer.resize(capacity);
+}
+
+void FrameEncoder::append(const char* bytes, size_t size) {
+    reserve(size);
+    std::memcpy(&buffer[length], bytes, size);
+    length += size;
+}
+
+void FrameEncoder::append(const std::string& text) {
+    append(text.data(), text.size());
+}
+
+void FrameEncoder::append(char c) {
+    reserve(1);
+    buffer[length++] = c;
+}
+
+void FrameEncoder::appendSpaces(int count) {
+    if (count <= 0) return;
+    reserve(count);
+    std::memset(&buffer[length], ' ', count);
+    length += count;
+}
+
+void FrameEncoder::appendNumber(int value) {
+    char digits[12];
+    int count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    reserve(count);
+    while (count > 0) {
+        buffer[length++] = digits[--count];
+    }
+}
+
+void FrameEncoder::moveCursor(int x, int y) {
+    append("\033[", 2);
+    appendNumber(y + 1);
+    append(';');
+    appendNumber(x + 1);
+    append('H');
+}
+
+void FrameEncoder::clearScreen() {
+    append("\033[H\033[2J", 7);
+}
+
+void FrameEncoder::clearLine() {
+    append("\033[2K", 4);
+}
+
+void FrameEncoder::setColor(PlatformUtils::Color color) {
+    if (!colorEnabled || currentColor == color) return;
+
+    // SGR 30-37 для цветов, 39 - цвет по умолчанию
+    char code[5] = { '\033', '[', '3', static_cast<char>('0' + color), 'm' };
+    append(code, sizeof(code));
+    currentColor = color;
+}
+
+void FrameEncoder::appendGlyph(const Glyph& glyph) {
+    if (!colorEnabled || currentColor == glyph.color) {
+        append(glyph.encoded + glyph.glyphOffset, glyph.length - glyph.glyphOffset);
+        return;
+    }
+
+    // Код цвета и глиф лежат подряд - одно копирование
+    append(glyph.encoded, glyph.length);
+    currentColor = glyph.color;
+}
+
+void FrameEncoder::appendRow(const char* cells, int count, const GlyphTheme& theme) {
+    const bool vectorized = hasSsse3();
+
+    int x = 0;
+    while (x < count) {
+        if (vectorized && count - x >= BLOCK_CELLS && appendBlock(cells + x, theme)) {
+            x += BLOCK_CELLS;
+            continue;
+        }
+
+        // Блок с многобайтовыми глифами или хвост строки - по одной клетке
+        int end = std::min(count, x + BLOCK_CELLS);
+        for (; x < end; x++) {
+            appendGlyph(theme.get(cells[x]));
+        }
+    }
+}
+
+bool FrameEncoder::appendBlock(const char* cells, const GlyphTheme& theme) {
+    unsigned char glyphs[BLOCK_CELLS];
+    unsigned char colors[BLOCK_CELLS];
+    unsigned int changes = 0;
+    if (!translateBlock(cells, theme.getAsciiBytes(), theme.getAsciiColors(),
+                        currentColor, glyphs, colors, changes)) {
+        return false;
+    }
+    if (!colorEnabled) changes = 0;
+
+    // Худший случай - код цвета перед каждой клеткой
+    reserve(BLOCK_CELLS * (COLOR_CODE_BYTES + 1));
+    char* out = &buffer[length];
+    int start = 0;
+    for (int x = 0; changes != 0; x++, changes >>= 1) {
+        if ((changes & 1) == 0) continue;
+
+        std::memcpy(out, glyphs + start, x - start);
+        out += x - start;
+        const char code[COLOR_CODE_BYTES] = { '\033', '[', '3', static_cast<char>('0' + colors[x]), 'm' };
+        std::memcpy(out, code, COLOR_CODE_BYTES);
+        out += COLOR_CODE_BYTES;
+        start = x;
+    }
+    std::memcpy(out, glyphs + start, BLOCK_CELLS - start);
+    out += BLOCK_CELLS - start;
+
+    length = out - buffer.data();
+    if (colorEnabled) currentColor = colors[BLOCK_CELLS - 1];
+    return true;
+}
+
+void FrameEncoder::setColorEnabled(bool enabled) {
+    colorEnabled = enabled;
+}
+
+void FrameEncoder::resetColor() {
+    append("\033[0m", 4);
+    currentColor = PlatformUtils::Color::DEFAULT;
+}
+
+bool FrameEncoder::flush(RenderSink& sink) {
+    bool ok = sink.write(buffer.data(), length);
+    length = 0;
+    return ok;
+}
+
+size_t FrameEncoder::size() const {
+    return length;
+}
+
+const char* FrameEncoder::data() const {
+    return buffer.data();
+}
@@ -0,0 +1,170 @@
+/**
+ * @file FrameEncoder.h
+ * @author Vld251
+ * @brief Byte buffer that encodes a whole terminal frame for a single write.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef FRAMEENCODER_H
+#define FRAMEENCODER_H
+
+#include "../utils/PlatformUtils.h"
+#include "GlyphTheme.h"
+#include "RenderSink.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Accumulates text, cursor moves and colors of one frame.
+ * 
+ * The buffer is allocated once and reused between frames. Color codes are
+ * emitted only when the color actually changes, so runs of cells with the
+ * same color cost one escape sequence. The finished frame is handed to a
+ * render sink in one call.
+ */
+class FrameEncoder {
+private:
+    std::vector<char> buffer;   ///< Encoded bytes (capacity reused between frames)
+    size_t length;              ///< Number of bytes used in buffer
+    int currentColor;           ///< Color active on terminal, -1 if unknown
+    bool colorEnabled;          ///< Whether color codes are emitted at all
+
+    void reserve(size_t extra);         ///< Grows buffer to fit extra bytes
+    void appendNumber(int value);       ///< Appends non-negative decimal number
+    bool appendBlock(const char* cells, const GlyphTheme& theme); ///< Encodes 16 cells with byte shuffles, false if a glyph is not one byte
+
+public:
+    static const size_t DEFAULT_CAPACITY = 64 * 1024;  ///< Initial buffer size in bytes
+
+    /**
+     * @brief Constructs an encoder with preallocated buffer.
+     * @param capacity Initial buffer size in bytes.
+     * @returns None
+     */
+    explicit FrameEncoder(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Starts a new frame, dropping previous contents.
+     * 
+     * Terminal color is treated as unknown, so the first color is always emitted.
+     * @returns None
+     */
+    void begin();
+
+    /**
+     * @brief Appends raw bytes.
+     * @param bytes Bytes to append.
+     * @param size Number of bytes.
+     * @returns None
+     */
+    void append(const char* bytes, size_t size);
+
+    /**
+     * @brief Appends a string.
+     * @param text Text to append.
+     * @returns None
+     */
+    void append(const std::string& text);
+
+    /**
+     * @brief Appends a single character.
+     * @param c Character to append.
+     * @returns None
+     */
+    void append(char c);
+
+    /**
+     * @brief Appends a run of spaces.
+     * @param count Number of spaces.
+     * @returns None
+     */
+    void appendSpaces(int count);
+
+    /**
+     * @brief Appends cursor move sequence.
+     * @param x Column (0-based).
+     * @param y Row (0-based).
+     * @returns None
+     */
+    void moveCursor(int x, int y);
+
+    /**
+     * @brief Appends sequence that homes cursor and clears screen.
+     * @returns None
+     */
+    void clearScreen();
+
+    /**
+     * @brief Appends sequence that erases current line.
+     * @returns None
+     */
+    void clearLine();
+
+    /**
+     * @brief Switches text color, emitting a code only if it differs from current.
+     * @param color Color to set.
+     * @returns None
+     */
+    void setColor(PlatformUtils::Color color);
+
+    /**
+     * @brief Appends pre-encoded glyph, skipping its color code if color is already active.
+     * @param glyph Glyph to append.
+     * @returns None
+     */
+    void appendGlyph(const Glyph& glyph);
+
+    /**
+     * @brief Appends glyphs of a row of map symbols.
+     * 
+     * Produces the same bytes as appendGlyph for every cell. Symbols with
+     * single-byte glyphs are translated 16 at a time through byte shuffles
+     * of the theme tables when the CPU has SSSE3, and color codes are
+     * inserted only where the color changes. Cells with longer glyphs and
+     * CPUs without SSSE3 take the per-cell table path.
+     * @param cells Map symbols.
+     * @param count Number of cells.
+     * @param theme Theme translating symbols to glyphs.
+     * @returns None
+     */
+    void appendRow(const char* cells, int count, const GlyphTheme& theme);
+
+    /**
+     * @brief Enables or disables color codes from setColor and appendGlyph.
+     * @param enabled Whether colors should be emitted.
+     * @returns None
+     */
+    void setColorEnabled(bool enabled);
+
+    /**
+     * @brief Resets all attributes to terminal defaults.
+     * @returns None
+     */
+    void resetColor();
+
+    /**
+     * @brief Sends encoded frame to a sink and empties the buffer.
+     * @param sink Destination of the frame.
+     * @return true if all bytes were written, false on error.
+     */
+    bool flush(RenderSink& sink);
+
+    /**
+     * @brief Gets number of encoded bytes.
+     * @return Frame size in bytes.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Gets encoded bytes.
+     * @return Pointer to first byte.
+     */
+    const char* data() const;
+};
+
+#endif // FRAMEENCODER_H
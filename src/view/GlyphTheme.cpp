@@ -0,0 +1,219 @@
+/**
+ * @file GlyphTheme.cpp
+ * @author Vld251
+ * @brief Implementation of precompiled glyph themes and theme file loading.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "GlyphTheme.h"
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <algorithm>
+#include <dirent.h>
+
+const int Glyph::MAX_BYTES;
+const int GlyphTheme::ASCII_SYMBOLS;
+const int GlyphTheme::ADVANCED_INDEX;
+const int GlyphTheme::ASCII_INDEX;
+
+namespace {
+
+// Названия цветов в файлах тем
+const char* const COLOR_NAMES[] = {
+    "black", "red", "green", "yellow", "blue", "magenta", "cyan", "white", "", "default"
+};
+
+bool parseColor(const std::string& text, PlatformUtils::Color& color) {
+    for (int i = 0; i < 10; i++) {
+        if (COLOR_NAMES[i][0] != '\0' && text == COLOR_NAMES[i]) {
+            color = static_cast<PlatformUtils::Color>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+GlyphTheme::GlyphTheme(const std::string& themeName) : name(themeName), unicode(false) {
+    // По умолчанию символ отображается сам собой без цвета
+    for (int i = 0; i < 256; i++) {
+        char symbol = (i >= 32 && i < 127) ? static_cast<char>(i) : '?';
+        set(static_cast<char>(i), std::string(1, symbol), PlatformUtils::Color::DEFAULT);
+    }
+    unicode = false;
+}
+
+void GlyphTheme::set(char symbol, const std::string& glyph, PlatformUtils::Color color) {
+    Glyph& g = glyphs[static_cast<unsigned char>(symbol)];
+
+    // SGR 30-37 для цветов, 39 - цвет по умолчанию
+    g.encoded[0] = '\033';
+    g.encoded[1] = '[';
+    g.encoded[2] = '3';
+    g.encoded[3] = static_cast<char>('0' + color);
+    g.encoded[4] = 'm';
+    g.glyphOffset = 5;
+
+    size_t size = std::min(glyph.size(), static_cast<size_t>(Glyph::MAX_BYTES - g.glyphOffset));
+    std::memcpy(g.encoded + g.glyphOffset, glyph.data(), size);
+    g.length = static_cast<unsigned char>(g.glyphOffset + size);
+    g.color = static_cast<unsigned char>(color);
+
+    for (size_t i = 0; i < size; i++) {
+        if (static_cast<unsigned char>(glyph[i]) >= 0x80) unicode = true;
+    }
+
+    // Таблицы для построчного кодирования: однобайтовый глиф или 0
+    unsigned char index = static_cast<unsigned char>(symbol);
+    if (index < ASCII_SYMBOLS) {
+        unsigned char byte = size == 1 ? static_cast<unsigned char>(glyph[0]) : 0;
+        asciiBytes[index] = (byte >= 32 && byte < 127) ? byte : 0;
+        asciiColors[index] = static_cast<unsigned char>(color);
+    }
+}
+
+const Glyph& GlyphTheme::get(char symbol) const {
+    return glyphs[static_cast<unsigned char>(symbol)];
+}
+
+const unsigned char* GlyphTheme::getAsciiBytes() const {
+    return asciiBytes;
+}
+
+const unsigned char* GlyphTheme::getAsciiColors() const {
+    return asciiColors;
+}
+
+std::string GlyphTheme::getText(char symbol) const {
+    const Glyph& g = get(symbol);
+    return std::string(g.encoded + g.glyphOffset, g.length - g.glyphOffset);
+}
+
+const std::string& GlyphTheme::getName() const {
+    return name;
+}
+
+bool GlyphTheme::needsUnicode() const {
+    return unicode;
+}
+
+bool GlyphTheme::loadFromFile(const std::string& path, GlyphTheme& theme) {
+    std::ifstream file(path);
+    if (!file.is_open()) return false;
+
+    // Тема по умолчанию строится поверх ASCII, чтобы незаданные символы выглядели привычно
+    theme = ascii();
+    theme.name = path;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        if (line.compare(0, 5, "name=") == 0) {
+            theme.name = line.substr(5);
+            continue;
+        }
+
+        // Формат: <символ> <глиф> <цвет>
+        std::istringstream fields(line.substr(1));
+        std::string glyph, colorName;
+        PlatformUtils::Color color = PlatformUtils::Color::DEFAULT;
+        if (!(fields >> glyph)) continue;
+        if (fields >> colorName && !parseColor(colorName, color)) continue;
+
+        theme.set(line[0], glyph, color);
+    }
+    return true;
+}
+
+GlyphTheme GlyphTheme::advanced() {
+    GlyphTheme theme("advanced");
+
+    theme.set('^', "▲", PlatformUtils::Color::GREEN);
+    theme.set('v', "▼", PlatformUtils::Color::GREEN);
+    theme.set('<', "◄", PlatformUtils::Color::GREEN);
+    theme.set('>', "►", PlatformUtils::Color::GREEN);
+
+    theme.set('A', "A", PlatformUtils::Color::RED);
+    theme.set('E', "E", PlatformUtils::Color::RED);
+    theme.set('F', "F", PlatformUtils::Color::RED);
+    theme.set('D', "D", PlatformUtils::Color::RED);
+
+    theme.set('S', "★", PlatformUtils::Color::MAGENTA);
+    theme.set('K', "¶", PlatformUtils::Color::MAGENTA);
+    theme.set('B', "➤", PlatformUtils::Color::MAGENTA);
+    theme.set('L', "❤", PlatformUtils::Color::MAGENTA);
+
+    theme.set('#', "█", PlatformUtils::Color::DEFAULT);
+    theme.set('X', "▓", PlatformUtils::Color::DEFAULT);
+
+    theme.set('~', "░", PlatformUtils::Color::BLUE);
+    theme.set('*', "§", PlatformUtils::Color::GREEN);
+
+    theme.set('O', "●", PlatformUtils::Color::YELLOW);
+    return theme;
+}
+
+GlyphTheme GlyphTheme::ascii() {
+    GlyphTheme theme("ascii");
+
+    theme.set('^', "^", PlatformUtils::Color::GREEN);
+    theme.set('v', "v", PlatformUtils::Color::GREEN);
+    theme.set('<', "<", PlatformUtils::Color::GREEN);
+    theme.set('>', ">", PlatformUtils::Color::GREEN);
+
+    theme.set('A', "A", PlatformUtils::Color::RED);
+    theme.set('E', "E", PlatformUtils::Color::RED);
+    theme.set('F', "F", PlatformUtils::Color::RED);
+    theme.set('D', "D", PlatformUtils::Color::RED);
+
+    theme.set('S', "S", PlatformUtils::Color::MAGENTA);
+    theme.set('K', "K", PlatformUtils::Color::MAGENTA);
+    theme.set('B', "B", PlatformUtils::Color::MAGENTA);
+    theme.set('L', "L", PlatformUtils::Color::MAGENTA);
+
+    theme.set('|', "|", PlatformUtils::Color::WHITE);
+    theme.set('-', "-", PlatformUtils::Color::WHITE);
+
+    theme.set('~', "~", PlatformUtils::Color::BLUE);
+    theme.set('*', "*", PlatformUtils::Color::GREEN);
+
+    theme.set('O', "@", PlatformUtils::Color::YELLOW);
+    return theme;
+}
+
+std::vector<GlyphTheme> GlyphTheme::loadAll(const std::string& directory) {
+    // Порядок встроенных тем задан ADVANCED_INDEX и ASCII_INDEX
+    std::vector<GlyphTheme> themes;
+    themes.push_back(advanced());
+    themes.push_back(ascii());
+
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) return themes;
+
+    // Пользовательские темы - все .theme файлы каталога
+    std::vector<std::string> files;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        std::string filename = entry->d_name;
+        if (filename.length() > 6 && filename.substr(filename.length() - 6) == ".theme") {
+            files.push_back(directory + "/" + filename);
+        }
+    }
+    closedir(dir);
+
+    std::sort(files.begin(), files.end());
+    for (const std::string& path : files) {
+        GlyphTheme theme;
+        if (loadFromFile(path, theme)) {
+            themes.push_back(theme);
+        }
+    }
+    return themes;
+}
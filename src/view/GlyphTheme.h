@@ -0,0 +1,144 @@
+/**
+ * @file GlyphTheme.h
+ * @author Vld251
+ * @brief Precompiled symbol-to-glyph tables used by the console renderer.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef GLYPHTHEME_H
+#define GLYPHTHEME_H
+
+#include "../utils/PlatformUtils.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Pre-encoded output of one map symbol.
+ * 
+ * Holds the color code immediately followed by the UTF-8 glyph, so a cell
+ * is emitted with one copy; when the color is already active only the
+ * glyph part (starting at glyphOffset) is copied.
+ */
+struct Glyph {
+    static const int MAX_BYTES = 16;    ///< Capacity of encoded sequence
+
+    char encoded[MAX_BYTES];    ///< Color code followed by glyph bytes
+    unsigned char length;       ///< Total encoded length
+    unsigned char glyphOffset;  ///< Offset of glyph bytes in encoded
+    unsigned char color;        ///< Color of glyph (PlatformUtils::Color)
+};
+
+/**
+ * @brief Table translating every map symbol to its on-screen glyph and color.
+ * 
+ * Built once (at startup or when a theme file is loaded); translating a
+ * cell is then a single array index.
+ */
+class GlyphTheme {
+public:
+    static const int ASCII_SYMBOLS = 128;   ///< Size of single-byte translation tables
+
+private:
+    std::string name;           ///< Theme name shown in settings
+    Glyph glyphs[256];          ///< Glyph per symbol byte
+    bool unicode;               ///< Whether any glyph needs a Unicode terminal
+    unsigned char asciiBytes[ASCII_SYMBOLS];    ///< Single-byte glyph per ASCII symbol, 0 if glyph is longer
+    unsigned char asciiColors[ASCII_SYMBOLS];   ///< Glyph color per ASCII symbol
+
+public:
+    /**
+     * @brief Constructs a theme that shows every symbol as itself.
+     * @param themeName Theme name.
+     * @returns None
+     */
+    explicit GlyphTheme(const std::string& themeName = "");
+
+    /**
+     * @brief Sets glyph and color of a symbol.
+     * @param symbol Map symbol.
+     * @param glyph UTF-8 text to show (at most 8 bytes).
+     * @param color Glyph color.
+     * @returns None
+     */
+    void set(char symbol, const std::string& glyph, PlatformUtils::Color color);
+
+    /**
+     * @brief Gets pre-encoded glyph of a symbol.
+     * @param symbol Map symbol.
+     * @return Const reference to glyph.
+     */
+    const Glyph& get(char symbol) const;
+
+    /**
+     * @brief Gets table translating ASCII symbols to single-byte glyphs.
+     * 
+     * Entry is 0 when the glyph of the symbol is not a single printable byte.
+     * Laid out as 8 rows of 16 entries, so it can be indexed by byte shuffles.
+     * @return Pointer to ASCII_SYMBOLS entries.
+     */
+    const unsigned char* getAsciiBytes() const;
+
+    /**
+     * @brief Gets table of glyph colors of ASCII symbols.
+     * @return Pointer to ASCII_SYMBOLS entries (PlatformUtils::Color values).
+     */
+    const unsigned char* getAsciiColors() const;
+
+    /**
+     * @brief Gets glyph text of a symbol without color code.
+     * @param symbol Map symbol.
+     * @return Glyph text.
+     */
+    std::string getText(char symbol) const;
+
+    /**
+     * @brief Gets theme name.
+     * @return Theme name.
+     */
+    const std::string& getName() const;
+
+    /**
+     * @brief Checks if theme uses non-ASCII glyphs.
+     * @return true if Unicode terminal is required, false otherwise.
+     */
+    bool needsUnicode() const;
+
+    /**
+     * @brief Loads theme from file.
+     * 
+     * File format: "name=<name>" line, then "<symbol> <glyph> <color>" lines.
+     * Lines starting with '#' are comments.
+     * @param path Path to theme file.
+     * @param theme Loaded theme.
+     * @return true if file was read, false otherwise.
+     */
+    static bool loadFromFile(const std::string& path, GlyphTheme& theme);
+
+    /**
+     * @brief Creates built-in Unicode theme.
+     * @return Theme named "advanced".
+     */
+    static GlyphTheme advanced();
+
+    /**
+     * @brief Creates built-in ASCII theme.
+     * @return Theme named "ascii".
+     */
+    static GlyphTheme ascii();
+
+    static const int ADVANCED_INDEX = 0;    ///< Position of the built-in Unicode theme in loadAll()
+    static const int ASCII_INDEX = 1;       ///< Position of the built-in ASCII theme in loadAll()
+
+    /**
+     * @brief Loads built-in themes followed by user themes from directory.
+     * @param directory Directory with .theme files.
+     * @return All available themes, built-in first (at ADVANCED_INDEX and ASCII_INDEX).
+     */
+    static std::vector<GlyphTheme> loadAll(const std::string& directory);
+};
+
+#endif // GLYPHTHEME_H
@@ -0,0 +1,95 @@
+/**
+ * @file OutputPacer.cpp
+ * @author Vld251
+ * @brief Implementation of adaptive terminal output pacing.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "OutputPacer.h"
+#include <cstdio>
+
+const int OutputPacer::SLOW_FRAMES;
+const int OutputPacer::FAST_FRAMES;
+const int OutputPacer::SLOW_WRITE_MS;
+const int OutputPacer::FAST_WRITE_MS;
+
+OutputPacer::OutputPacer()
+    : mode(PacingMode::NORMAL), writeMillis(0.0), frameBytes(0.0),
+      bytesPerSecond(0.0), slowFrames(0), fastFrames(0), windowBytes(0),
+      windowStart(Clock::now()) {}
+
+void OutputPacer::recordFrame(size_t bytes, double writeSeconds) {
+    double millis = writeSeconds * 1000.0;
+
+    // Сглаживаем, чтобы один медленный кадр не переключал режим
+    writeMillis = writeMillis * 0.8 + millis * 0.2;
+    frameBytes = frameBytes * 0.8 + static_cast<double>(bytes) * 0.2;
+
+    // Скорость вывода считаем по окнам в одну секунду
+    windowBytes += bytes;
+    Clock::time_point now = Clock::now();
+    double elapsed = std::chrono::duration<double>(now - windowStart).count();
+    if (elapsed >= 1.0) {
+        bytesPerSecond = windowBytes / elapsed;
+        windowBytes = 0;
+        windowStart = now;
+    }
+
+    if (writeMillis > SLOW_WRITE_MS) {
+        fastFrames = 0;
+        if (++slowFrames >= SLOW_FRAMES && mode != PacingMode::NO_COLOR) {
+            mode = static_cast<PacingMode>(static_cast<int>(mode) + 1);
+            slowFrames = 0;
+        }
+    } else if (writeMillis < FAST_WRITE_MS) {
+        slowFrames = 0;
+        if (++fastFrames >= FAST_FRAMES && mode != PacingMode::NORMAL) {
+            mode = static_cast<PacingMode>(static_cast<int>(mode) - 1);
+            fastFrames = 0;
+        }
+    } else {
+        slowFrames = 0;
+        fastFrames = 0;
+    }
+}
+
+PacingMode OutputPacer::getMode() const {
+    return mode;
+}
+
+int OutputPacer::getFrameInterval() const {
+    if (mode == PacingMode::NORMAL) return 0;
+
+    // Даем терминалу время разобрать прошлый кадр - промежуточные снимки пропадут
+    int interval = static_cast<int>(writeMillis * 2.0);
+    return interval < SLOW_WRITE_MS ? SLOW_WRITE_MS : interval;
+}
+
+bool OutputPacer::colorEnabled() const {
+    return mode != PacingMode::NO_COLOR;
+}
+
+bool OutputPacer::diffOnly() const {
+    return mode == PacingMode::DIFF_ONLY || mode == PacingMode::NO_COLOR;
+}
+
+std::string OutputPacer::describe() const {
+    char text[96];
+    std::snprintf(text, sizeof(text), "[%s] write %.1f ms | frame %.0f B | %.1f KB/s",
+                  modeName(mode), writeMillis, frameBytes, bytesPerSecond / 1024.0);
+    return text;
+}
+
+const char* OutputPacer::modeName(PacingMode mode) {
+    switch (mode) {
+        case PacingMode::NORMAL:      return "normal";
+        case PacingMode::SKIP_FRAMES: return "skip frames";
+        case PacingMode::DIFF_ONLY:   return "diff only";
+        case PacingMode::NO_COLOR:    return "no color";
+    }
+    return "?";
+}
@@ -0,0 +1,111 @@
+/**
+ * @file OutputPacer.h
+ * @author Vld251
+ * @brief Measures terminal write speed and picks how much to send per frame.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef OUTPUTPACER_H
+#define OUTPUTPACER_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Output strategies, from full quality to cheapest.
+ * 
+ * Each mode also applies everything from the modes before it.
+ */
+enum class PacingMode {
+    NORMAL,       ///< Every snapshot, full redraws when needed
+    SKIP_FRAMES,  ///< Waits between frames so intermediate snapshots are dropped
+    DIFF_ONLY,    ///< Additionally skips optional full redraws (damage flash border)
+    NO_COLOR      ///< Additionally drops color codes
+};
+
+/**
+ * @brief Tracks write latency and frame size and adapts the pacing mode.
+ * 
+ * A write to a terminal blocks once the pty buffer is full, so a long
+ * write means the terminal drains slower than frames are produced. After a
+ * few slow frames the pacer moves to a cheaper mode; after a longer run of
+ * fast frames it moves back one step.
+ */
+class OutputPacer {
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    static const int SLOW_FRAMES = 3;    ///< Slow frames in a row before stepping down
+    static const int FAST_FRAMES = 60;   ///< Fast frames in a row before stepping up
+
+    PacingMode mode;              ///< Current output strategy
+    double writeMillis;           ///< Smoothed write latency
+    double frameBytes;            ///< Smoothed frame size
+    double bytesPerSecond;        ///< Output rate over the last full second
+    int slowFrames;               ///< Consecutive frames slower than the limit
+    int fastFrames;               ///< Consecutive frames well under the limit
+    size_t windowBytes;           ///< Bytes written in the current rate window
+    Clock::time_point windowStart; ///< Start of the current rate window
+
+public:
+    static const int SLOW_WRITE_MS = 15;  ///< Write latency meaning the terminal is behind
+    static const int FAST_WRITE_MS = 2;   ///< Write latency meaning the terminal keeps up
+
+    /**
+     * @brief Constructs a pacer in NORMAL mode.
+     * @returns None
+     */
+    OutputPacer();
+
+    /**
+     * @brief Records one written frame and updates the mode.
+     * @param bytes Frame size in bytes.
+     * @param writeSeconds Time spent writing the frame.
+     * @returns None
+     */
+    void recordFrame(size_t bytes, double writeSeconds);
+
+    /**
+     * @brief Gets current output strategy.
+     * @return Pacing mode.
+     */
+    PacingMode getMode() const;
+
+    /**
+     * @brief Gets pause to keep between frames in the current mode.
+     * @return Milliseconds to wait before presenting the next frame (0 if none).
+     */
+    int getFrameInterval() const;
+
+    /**
+     * @brief Checks if color codes should be sent.
+     * @return true if colors are enabled in the current mode.
+     */
+    bool colorEnabled() const;
+
+    /**
+     * @brief Checks if optional full redraws should be skipped.
+     * @return true in DIFF_ONLY and cheaper modes.
+     */
+    bool diffOnly() const;
+
+    /**
+     * @brief Builds one-line description for the debug overlay.
+     * @return Mode name and measured rates.
+     */
+    std::string describe() const;
+
+    /**
+     * @brief Gets name of a pacing mode.
+     * @param mode Pacing mode.
+     * @return Mode name.
+     */
+    static const char* modeName(PacingMode mode);
+};
+
+#endif // OUTPUTPACER_H
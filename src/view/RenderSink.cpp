@@ -0,0 +1,296 @@
+/**
+ * @file RenderSink.cpp
+ * @author Vld251
+ * @brief Implementation of terminal, discard, asciicast and in-memory render sinks.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "RenderSink.h"
+#include "../utils/PlatformUtils.h"
+#include <cstdio>
+#include <cerrno>
+#include <ctime>
+#include <algorithm>
+#include <iostream>
+
+bool TerminalSink::write(const char* data, size_t size) {
+    // Все, что ранее ушло через std::cout, должно оказаться на экране раньше кадра
+    std::cout.flush();
+
+#ifdef _WIN32
+    size_t written = std::fwrite(data, 1, size, stdout);
+    std::fflush(stdout);
+    return written == size;
+#else
+    size_t offset = 0;
+    while (offset < size) {
+        ssize_t result = ::write(STDOUT_FILENO, data + offset, size - offset);
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        offset += static_cast<size_t>(result);
+    }
+    return true;
+#endif
+}
+
+std::pair<int, int> TerminalSink::getSize() {
+    return PlatformUtils::getCachedTerminalSize();
+}
+
+NullSink::NullSink(int width, int height)
+    : columns(width), rows(height), bytesWritten(0), framesWritten(0) {}
+
+bool NullSink::write(const char*, size_t size) {
+    bytesWritten += size;
+    framesWritten++;
+    return true;
+}
+
+std::pair<int, int> NullSink::getSize() {
+    return {columns, rows};
+}
+
+size_t NullSink::getBytesWritten() const {
+    return bytesWritten;
+}
+
+size_t NullSink::getFramesWritten() const {
+    return framesWritten;
+}
+
+AsciicastSink::AsciicastSink(const std::string& path, int width, int height, RenderSink* next)
+    : file(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc),
+      forward(next), columns(width), rows(height),
+      start(std::chrono::steady_clock::now()) {
+    if (file) {
+        // Заголовок asciicast v2 - первая строка файла
+        file << "{\"version\": 2, \"width\": " << columns << ", \"height\": " << rows
+             << ", \"timestamp\": " << static_cast<long long>(std::time(nullptr)) << "}\n";
+    }
+}
+
+bool AsciicastSink::isOpen() const {
+    return file.is_open() && file.good();
+}
+
+bool AsciicastSink::write(const char* data, size_t size) {
+    bool ok = forward ? forward->write(data, size) : true;
+    if (!file) return ok;
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    char time[32];
+    std::snprintf(time, sizeof(time), "[%.6f, \"o\", \"", elapsed);
+
+    // Событие: [время, "o", "данные"], данные экранируются как JSON-строка
+    event.assign(time);
+    for (size_t i = 0; i < size; i++) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if (c == '"' || c == '\\') {
+            event += '\\';
+            event += static_cast<char>(c);
+        } else if (c == '\n') {
+            event += "\\n";
+        } else if (c == '\r') {
+            event += "\\r";
+        } else if (c < 0x20 || c == 0x7f) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            event += escaped;
+        } else {
+            event += static_cast<char>(c); // UTF-8 проходит как есть
+        }
+    }
+    event += "\"]\n";
+
+    file.write(event.data(), static_cast<std::streamsize>(event.size()));
+    return ok && file.good();
+}
+
+std::pair<int, int> AsciicastSink::getSize() {
+    if (forward) return forward->getSize();
+    return {columns, rows};
+}
+
+MemorySink::MemorySink(int width, int height)
+    : columns(width), rows(height),
+      cells(static_cast<size_t>(width) * height, " "),
+      colors(static_cast<size_t>(width) * height, -1),
+      cursorX(0), cursorY(0), color(-1), state(ParseState::TEXT),
+      glyphRemaining(0), bytesWritten(0) {}
+
+bool MemorySink::write(const char* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        feed(data[i]);
+    }
+    bytesWritten += size;
+    return true;
+}
+
+std::pair<int, int> MemorySink::getSize() {
+    return {columns, rows};
+}
+
+void MemorySink::feed(char c) {
+    unsigned char byte = static_cast<unsigned char>(c);
+
+    if (state == ParseState::ESCAPE) {
+        if (c == '[') {
+            state = ParseState::CSI;
+            params.clear();
+        } else {
+            state = ParseState::TEXT; // Прочие ESC-последовательности не нужны
+        }
+        return;
+    }
+
+    if (state == ParseState::CSI) {
+        if (byte >= 0x40 && byte <= 0x7e) {
+            handleCsi(c);
+            state = ParseState::TEXT;
+        } else {
+            params += c;
+        }
+        return;
+    }
+
+    // Продолжение многобайтового UTF-8 символа
+    if (glyphRemaining > 0 && (byte & 0xC0) == 0x80) {
+        glyph += c;
+        if (--glyphRemaining == 0) {
+            putGlyph();
+        }
+        return;
+    }
+    glyphRemaining = 0;
+
+    if (c == '\033') {
+        state = ParseState::ESCAPE;
+    } else if (c == '\n') {
+        // Терминал в каноническом выводе превращает \n в \r\n
+        cursorX = 0;
+        lineFeed();
+    } else if (c == '\r') {
+        cursorX = 0;
+    } else if (byte >= 0xC0) {
+        glyph.assign(1, c);
+        glyphRemaining = byte >= 0xF0 ? 3 : (byte >= 0xE0 ? 2 : 1);
+    } else if (byte >= 0x20) {
+        glyph.assign(1, c);
+        putGlyph();
+    }
+}
+
+void MemorySink::putGlyph() {
+    if (cursorX >= columns) {
+        cursorX = 0;
+        lineFeed();
+    }
+    size_t index = static_cast<size_t>(cursorY) * columns + cursorX;
+    cells[index] = glyph;
+    colors[index] = color;
+    cursorX++;
+}
+
+void MemorySink::lineFeed() {
+    if (cursorY + 1 < rows) {
+        cursorY++;
+        return;
+    }
+
+    // Нижняя строка - прокручиваем экран на одну строку вверх
+    cells.erase(cells.begin(), cells.begin() + columns);
+    cells.resize(static_cast<size_t>(columns) * rows, " ");
+    colors.erase(colors.begin(), colors.begin() + columns);
+    colors.resize(static_cast<size_t>(columns) * rows, -1);
+}
+
+void MemorySink::clearRange(size_t from, size_t to) {
+    for (size_t i = from; i < to && i < cells.size(); i++) {
+        cells[i] = " ";
+        colors[i] = -1;
+    }
+}
+
+void MemorySink::handleCsi(char command) {
+    // Приватные режимы (?1049h, ?25l) на содержимое экрана не влияют
+    if (!params.empty() && params[0] == '?') return;
+
+    std::vector<int> values;
+    int current = -1;
+    for (char p : params) {
+        if (p >= '0' && p <= '9') {
+            current = (current < 0 ? 0 : current * 10) + (p - '0');
+        } else if (p == ';') {
+            values.push_back(current);
+            current = -1;
+        }
+    }
+    values.push_back(current);
+
+    size_t rowStart = static_cast<size_t>(cursorY) * columns;
+    switch (command) {
+        case 'H': {
+            int row = values.size() > 0 && values[0] > 0 ? values[0] : 1;
+            int col = values.size() > 1 && values[1] > 0 ? values[1] : 1;
+            cursorY = std::min(row, rows) - 1;
+            cursorX = std::min(col, columns) - 1;
+            break;
+        }
+        case 'J':
+            if (values[0] == 2 || values[0] == 3) {
+                clearRange(0, cells.size());
+            } else if (values[0] <= 0) {
+                clearRange(rowStart + cursorX, cells.size());
+            }
+            break;
+        case 'K':
+            if (values[0] == 2) {
+                clearRange(rowStart, rowStart + columns);
+            } else if (values[0] <= 0) {
+                clearRange(rowStart + cursorX, rowStart + columns);
+            }
+            break;
+        case 'm':
+            for (int value : values) {
+                if (value <= 0 || value == 39) {
+                    color = -1;
+                } else if (value >= 30 && value <= 37) {
+                    color = value - 30;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+const std::string& MemorySink::getCell(int x, int y) const {
+    static const std::string outside;
+    if (x < 0 || x >= columns || y < 0 || y >= rows) return outside;
+    return cells[static_cast<size_t>(y) * columns + x];
+}
+
+int MemorySink::getColor(int x, int y) const {
+    if (x < 0 || x >= columns || y < 0 || y >= rows) return -1;
+    return colors[static_cast<size_t>(y) * columns + x];
+}
+
+std::string MemorySink::getLine(int y) const {
+    std::string line;
+    for (int x = 0; x < columns; x++) {
+        line += getCell(x, y);
+    }
+    size_t end = line.find_last_not_of(' ');
+    line.erase(end == std::string::npos ? 0 : end + 1);
+    return line;
+}
+
+size_t MemorySink::getBytesWritten() const {
+    return bytesWritten;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file RenderSink.h
+ * @author Vld251
+ * @brief Destinations for encoded frames: terminal, discard, recording and memory.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef RENDERSINK_H
+#define RENDERSINK_H
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Receives encoded frames from the renderer.
+ * 
+ * The renderer only builds bytes; where they go and how large the screen
+ * is are decided by the sink. This lets rendering run without a TTY.
+ */
+class RenderSink {
+public:
+    /**
+     * @brief Destroys the sink.
+     * @returns None
+     */
+    virtual ~RenderSink() {}
+
+    /**
+     * @brief Outputs encoded bytes of one frame.
+     * @param data Encoded bytes.
+     * @param size Number of bytes.
+     * @return true if all bytes were accepted, false on error.
+     */
+    virtual bool write(const char* data, size_t size) = 0;
+
+    /**
+     * @brief Gets screen size the frames are drawn for.
+     * @return Pair of (columns, rows).
+     */
+    virtual std::pair<int, int> getSize() = 0;
+};
+
+/**
+ * @brief Writes frames to standard output and reads size from the terminal.
+ */
+class TerminalSink : public RenderSink {
+public:
+    /**
+     * @brief Writes bytes to standard output with a single write call where possible.
+     * @param data Encoded bytes.
+     * @param size Number of bytes.
+     * @return true if all bytes were accepted, false on error.
+     */
+    bool write(const char* data, size_t size) override;
+
+    /**
+     * @brief Gets terminal size, cached between resizes.
+     * @return Pair of (columns, rows).
+     */
+    std::pair<int, int> getSize() override;
+};
+
+/**
+ * @brief Discards frames, only counting them; for measuring render cost.
+ */
+class NullSink : public RenderSink {
+private:
+    int columns;            ///< Reported screen width
+    int rows;               ///< Reported screen height
+    size_t bytesWritten;    ///< Total bytes received
+    size_t framesWritten;   ///< Total writes received
+
+public:
+    /**
+     * @brief Constructs a sink reporting fixed screen size.
+     * @param width Screen width in columns.
+     * @param height Screen height in rows.
+     * @returns None
+     */
+    NullSink(int width, int height);
+
+    /**
+     * @brief Counts and discards bytes.
+     * @param data Encoded bytes.
+     * @param size Number of bytes.
+     * @return true if all bytes were accepted, false on error.
+     */
+    bool write(const char* data, size_t size) override;
+
+    /**
+     * @brief Gets size passed to the constructor.
+     * @return Pair of (columns, rows).
+     */
+    std::pair<int, int> getSize() override;
+
+    /**
+     * @brief Gets total bytes received.
+     * @return Byte count.
+     */
+    size_t getBytesWritten() const;
+
+    /**
+     * @brief Gets number of frames received.
+     * @return Frame count.
+     */
+    size_t getFramesWritten() const;
+};
+
+/**
+ * @brief Records frames into an asciicast v2 file, optionally passing them on.
+ * 
+ * The file can be replayed with asciinema or any compatible player. Each
+ * frame becomes one output event with its time since recording started.
+ */
+class AsciicastSink : public RenderSink {
+private:
+    std::ofstream file;                             ///< Recording file
+    RenderSink* forward;                            ///< Sink receiving frames as well, or nullptr
+    int columns;                                    ///< Screen width written to header
+    int rows;                                       ///< Screen height written to header
+    std::chrono::steady_clock::time_point start;    ///< Recording start
+    std::string event;                              ///< Reused buffer for one event line
+
+public:
+    /**
+     * @brief Opens recording file and writes its header.
+     * @param path Path of the .cast file.
+     * @param width Screen width in columns.
+     * @param height Screen height in rows.
+     * @param next Sink that also receives frames (e.g. the terminal), or nullptr.
+     * @returns None
+     */
+    AsciicastSink(const std::string& path, int width, int height, RenderSink* next = nullptr);
+
+    /**
+     * @brief Checks if recording file was opened.
+     * @return true if file is writable, false otherwise.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Appends bytes as an output event and forwards them.
+     * @param data Encoded bytes.
+     * @param size Number of bytes.
+     * @return true if all bytes were accepted, false on error.
+     */
+    bool write(const char* data, size_t size) override;
+
+    /**
+     * @brief Gets size of the forward sink, or recorded size without one.
+     * @return Pair of (columns, rows).
+     */
+    std::pair<int, int> getSize() override;
+};
+
+/**
+ * @brief Interprets frames into an inspectable character grid.
+ * 
+ * Understands the subset of output the renderer produces: text with UTF-8
+ * glyphs, newlines, cursor positioning, screen and line erasing and SGR
+ * colors. Other escape sequences are ignored.
+ */
+class MemorySink : public RenderSink {
+private:
+    enum class ParseState { TEXT, ESCAPE, CSI };
+
+    int columns;                    ///< Screen width
+    int rows;                       ///< Screen height
+    std::vector<std::string> cells; ///< Glyph (UTF-8) per cell, row by row
+    std::vector<int> colors;        ///< SGR foreground color per cell, -1 for default
+    int cursorX;                    ///< Cursor column
+    int cursorY;                    ///< Cursor row
+    int color;                      ///< Current foreground color
+    ParseState state;               ///< Escape sequence parser state
+    std::string params;             ///< Parameters of current CSI sequence
+    std::string glyph;              ///< Bytes of current UTF-8 character
+    int glyphRemaining;             ///< Continuation bytes still expected
+    size_t bytesWritten;            ///< Total bytes received
+
+    void feed(char c);                          ///< Parses one byte
+    void putGlyph();                            ///< Stores current glyph at cursor
+    void handleCsi(char command);               ///< Executes CSI sequence
+    void clearRange(size_t from, size_t to);    ///< Blanks cells [from, to)
+    void lineFeed();                            ///< Moves cursor down, scrolling at bottom
+
+public:
+    /**
+     * @brief Constructs a blank framebuffer.
+     * @param width Screen width in columns.
+     * @param height Screen height in rows.
+     * @returns None
+     */
+    MemorySink(int width, int height);
+
+    /**
+     * @brief Interprets bytes into the cell grid.
+     * @param data Encoded bytes.
+     * @param size Number of bytes.
+     * @return true if all bytes were accepted, false on error.
+     */
+    bool write(const char* data, size_t size) override;
+
+    /**
+     * @brief Gets framebuffer size.
+     * @return Pair of (columns, rows).
+     */
+    std::pair<int, int> getSize() override;
+
+    /**
+     * @brief Gets glyph shown in a cell.
+     * @param x Column.
+     * @param y Row.
+     * @return UTF-8 glyph, or empty string outside the screen.
+     */
+    const std::string& getCell(int x, int y) const;
+
+    /**
+     * @brief Gets color of a cell.
+     * @param x Column.
+     * @param y Row.
+     * @return SGR foreground color (0-7), or -1 for default.
+     */
+    int getColor(int x, int y) const;
+
+    /**
+     * @brief Gets text of a whole row.
+     * @param y Row.
+     * @return Row glyphs joined, trailing spaces removed.
+     */
+    std::string getLine(int y) const;
+
+    /**
+     * @brief Gets total bytes received.
+     * @return Byte count.
+     */
+    size_t getBytesWritten() const;
+};
+
+#endif // RENDERSINK_H
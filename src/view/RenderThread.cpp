@@ -0,0 +1,135 @@
+/**
+ * @file RenderThread.cpp
+ * @author Vld251
+ * @brief Implementation of the background render thread.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "RenderThread.h"
+#include <chrono>
+
+const int RenderThread::RESIZE_CHECK_MS;
+
+RenderThread::RenderThread(ConsoleRenderer& view)
+    : renderer(view), pending(false), busy(false), stopping(false), showing(false),
+      failed(false), published(0), presented(0), latency(nullptr) {}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+void RenderThread::start() {
+    if (worker.joinable()) return;
+
+    stopping = false;
+    worker = std::thread(&RenderThread::run, this);
+}
+
+void RenderThread::stop() {
+    if (!worker.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+RenderSnapshot& RenderThread::beginFrame() {
+    return snapshots.writeBuffer();
+}
+
+void RenderThread::publish() {
+    RenderSnapshot& frame = snapshots.writeBuffer();
+    frame.sequence = ++published;
+    frame.publishTime = std::chrono::steady_clock::now();
+    snapshots.publish();
+
+    if (!worker.joinable()) {
+        // Поток не запущен - рисуем сразу, как раньше
+        present();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = true;
+        showing = true;
+    }
+    wake.notify_one();
+}
+
+void RenderThread::drain() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return !pending && !busy; });
+    showing = false; // Экран переходит к игровому потоку
+}
+
+void RenderThread::setLatencyStats(LatencyStats* stats) {
+    latency = stats;
+}
+
+void RenderThread::present() {
+    // Между публикациями могло прийти несколько снимков - берём последний;
+    // после смены размера заново показываем уже показанный
+    snapshots.update();
+    const RenderSnapshot& frame = snapshots.readBuffer();
+    failed = !renderer.render(frame);
+
+    // Повторный показ того же снимка (после смены размера) не измеряем
+    if (failed || frame.sequence == presented) return;
+    presented = frame.sequence;
+    if (latency) {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        latency->record(LatencyStage::OUTPUT, now - frame.publishTime);
+        if (frame.hasInput) {
+            latency->record(LatencyStage::TOTAL, now - frame.inputTime);
+        }
+    }
+}
+
+bool RenderThread::hasFailed() const {
+    return failed;
+}
+
+void RenderThread::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    unsigned seenResize = PlatformUtils::getResizeGeneration();
+
+    // Смена размера терминала во время игры должна перерисовать кадр сразу,
+    // не дожидаясь следующего хода
+    auto resized = [&seenResize] { return PlatformUtils::getResizeGeneration() != seenResize; };
+
+    while (true) {
+        wake.wait_for(lock, std::chrono::milliseconds(RESIZE_CHECK_MS),
+                      [&] { return pending || stopping || (showing && resized()); });
+        if (stopping && !pending) break; // Остановка, и всё уже показано
+        if (!pending && !(showing && resized())) continue;
+
+        // Медленный терминал: выжидаем паузу, пока копятся снимки,
+        // и показываем только последний из них
+        int interval = renderer.getFrameInterval();
+        if (pending && interval > 0) {
+            wake.wait_for(lock, std::chrono::milliseconds(interval), [this] { return stopping; });
+        }
+
+        seenResize = PlatformUtils::getResizeGeneration();
+        pending = false;
+        busy = true;
+        lock.unlock();
+
+        present();
+
+        lock.lock();
+        busy = false;
+        if (!pending) {
+            idle.notify_all();
+        }
+    }
+    idle.notify_all();
+}
@@ -0,0 +1,123 @@
+/**
+ * @file RenderThread.h
+ * @author Vld251
+ * @brief Background thread presenting the newest game snapshot to the console.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#ifndef RENDERTHREAD_H
+#define RENDERTHREAD_H
+
+#include "ConsoleRenderer.h"
+#include "../model/RenderSnapshot.h"
+#include "../utils/TripleBuffer.h"
+#include "../utils/LatencyStats.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Runs ConsoleRenderer::render on its own thread.
+ * 
+ * The game thread fills a snapshot and publishes it through a triple buffer;
+ * the render thread wakes up and presents the newest one, skipping snapshots
+ * it did not manage to draw in time. A slow terminal therefore delays only
+ * the picture, not the simulation or input handling. While a game frame is
+ * on screen, a terminal resize redraws it without waiting for the next tick.
+ * 
+ * Menus and other screens are drawn by the game thread directly, so it must
+ * call drain() before touching the renderer or std::cout.
+ * 
+ * With latency statistics attached, every newly presented snapshot records
+ * its output time, and a snapshot showing a key press records the
+ * end-to-end delay from that key.
+ */
+class RenderThread {
+private:
+    ConsoleRenderer& renderer;              ///< Renderer owned by the controller
+    TripleBuffer<RenderSnapshot> snapshots; ///< Snapshots handed to the render thread
+    std::thread worker;                     ///< Render thread
+    std::mutex mutex;                       ///< Guards the flags below (not snapshot data)
+    std::condition_variable wake;           ///< Signals a new snapshot or stop request
+    std::condition_variable idle;           ///< Signals that all snapshots are presented
+    bool pending;                           ///< A published snapshot is not presented yet
+    bool busy;                              ///< Render thread is presenting a snapshot
+    bool stopping;                          ///< Render thread should exit
+    bool showing;                           ///< Game frame owns the screen (published, not drained)
+    std::atomic<bool> failed;               ///< Last render failed (terminal too small)
+    unsigned long published;                ///< Number of published snapshots
+    unsigned long presented;                ///< Sequence of the last presented snapshot (render side)
+    LatencyStats* latency;                  ///< Where presentation latencies go (not owned), may be null
+
+    static const int RESIZE_CHECK_MS = 50;  ///< How often an idle render thread checks for resizes
+
+    void run(); ///< Render thread body
+    void present(); ///< Renders the newest snapshot and records its latency
+
+public:
+    /**
+     * @brief Constructs a stopped render thread.
+     * @param view Renderer used for presenting snapshots.
+     * @returns None
+     */
+    explicit RenderThread(ConsoleRenderer& view);
+
+    /**
+     * @brief Stops the render thread.
+     * @returns None
+     */
+    ~RenderThread();
+
+    /**
+     * @brief Starts the render thread.
+     * @returns None
+     */
+    void start();
+
+    /**
+     * @brief Presents remaining snapshot and joins the render thread.
+     * @returns None
+     */
+    void stop();
+
+    /**
+     * @brief Gets snapshot to fill for the next frame (game thread only).
+     * @return Reference to writable snapshot.
+     */
+    RenderSnapshot& beginFrame();
+
+    /**
+     * @brief Hands filled snapshot to the render thread (game thread only).
+     * @returns None
+     */
+    void publish();
+
+    /**
+     * @brief Waits until every published snapshot is presented.
+     * 
+     * After it returns the render thread sleeps, and the game thread may
+     * use the renderer and std::cout directly.
+     * @returns None
+     */
+    void drain();
+
+    /**
+     * @brief Attaches latency statistics (call before start()).
+     * @param stats Statistics to record into (not owned), or nullptr to stop recording.
+     * @returns None
+     */
+    void setLatencyStats(LatencyStats* stats);
+
+    /**
+     * @brief Checks if the last frame could not be drawn.
+     * @return true if terminal was too small for the last frame.
+     */
+    bool hasFailed() const;
+};
+
+#endif // RENDERTHREAD_H
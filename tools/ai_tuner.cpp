@@ -0,0 +1,346 @@
+/**
+ * @file ai_tuner.cpp
+ * @author Vld251
+ * @brief Headless self-play harness sweeping enemy AI parameters across all cores.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "model/GameWorld.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Named AI parameter that can be swept from the command line.
+ */
+struct ParamField {
+    const char* name;           ///< Parameter name
+    int AIParams::*member;      ///< Field in AIParams
+};
+
+const ParamField PARAM_FIELDS[] = {
+    { "wanderMoveChance",          &AIParams::wanderMoveChance },
+    { "approachChance",            &AIParams::approachChance },
+    { "cautiousMoveChance",        &AIParams::cautiousMoveChance },
+    { "coverSidestepChance",       &AIParams::coverSidestepChance },
+    { "shotChanceBonus",           &AIParams::shotChanceBonus },
+    { "retreatDistance",           &AIParams::retreatDistance },
+    { "engageDistance",            &AIParams::engageDistance },
+    { "defensiveRetreatDistance",  &AIParams::defensiveRetreatDistance },
+    { "defensiveHoldDistance",     &AIParams::defensiveHoldDistance },
+    { "cautiousDistance",          &AIParams::cautiousDistance }
+};
+
+/**
+ * @brief One swept parameter with the values to try.
+ */
+struct SweepAxis {
+    const ParamField* field;    ///< Swept parameter
+    std::vector<int> values;    ///< Values to try
+};
+
+/**
+ * @brief Scripted player strategy.
+ */
+enum class BotKind { RANDOM, HUNTER };
+
+/**
+ * @brief Outcome of one headless match.
+ */
+struct MatchResult {
+    bool playerWon;             ///< Level cleared
+    bool playerLost;            ///< All lives lost
+    int ticks;                  ///< Simulated ticks
+    int firstKillTick;          ///< Tick the player first lost a life, -1 if never
+};
+
+/**
+ * @brief Settings of a tuning run.
+ */
+struct TunerOptions {
+    int matches;                ///< Matches per configuration
+    int threads;                ///< Worker threads
+    int maxTicks;               ///< Tick limit of a match
+    unsigned int seed;          ///< Base seed, match i uses seed + i
+    BotKind bot;                ///< Player strategy
+};
+
+// Проверяет, что между двумя клетками одной линии нет стен
+bool hasLineOfFire(const TerrainGrid& terrain, Point from, Point to) {
+    int dx = (to.x > from.x) - (to.x < from.x);
+    int dy = (to.y > from.y) - (to.y < from.y);
+    Point p = from;
+
+    while (!(p == to)) {
+        p.x += dx;
+        p.y += dy;
+        if (!(p == to) && terrain.blocksProjectiles(p)) return false;
+    }
+    return true;
+}
+
+Direction directionTo(Point from, Point to) {
+    if (from.x == to.x) return (to.y > from.y) ? Direction::DOWN : Direction::UP;
+    return (to.x > from.x) ? Direction::RIGHT : Direction::LEFT;
+}
+
+// Один ход бота-охотника: стреляет по врагу на линии, иначе выходит на линию ближайшего
+void hunterStep(GameWorld& world, std::mt19937& gen) {
+    PlayerTank* player = world.getPlayer();
+    Point pos = player->getPosition();
+    const EnemyTank* target = nullptr;
+    int bestDistance = 0;
+
+    for (const auto& obj : world.getObjects()) {
+        const EnemyTank* enemy = dynamic_cast<const EnemyTank*>(obj.get());
+        if (!enemy || enemy->isDestroyed()) continue;
+
+        Point e = enemy->getPosition();
+        if ((e.x == pos.x || e.y == pos.y) && hasLineOfFire(world.getTerrain(), pos, e)) {
+            player->rotate(directionTo(pos, e));
+            world.playerFire();
+            return;
+        }
+
+        int distance = std::abs(e.x - pos.x) + std::abs(e.y - pos.y);
+        if (!target || distance < bestDistance) {
+            target = enemy;
+            bestDistance = distance;
+        }
+    }
+
+    if (!target) return;
+
+    // Выравниваемся по оси с меньшим расхождением
+    Point e = target->getPosition();
+    int dx = e.x - pos.x;
+    int dy = e.y - pos.y;
+    Direction dir;
+    if (dx != 0 && (dy == 0 || std::abs(dx) < std::abs(dy))) {
+        dir = dx > 0 ? Direction::RIGHT : Direction::LEFT;
+    } else {
+        dir = dy > 0 ? Direction::DOWN : Direction::UP;
+    }
+
+    world.playerMove(dir);
+    if (player->getPosition() == pos) {
+        // Уперлись в препятствие - пробуем случайное направление
+        world.playerMove(static_cast<Direction>(gen() % 4));
+    }
+}
+
+void randomStep(GameWorld& world, std::mt19937& gen) {
+    int action = static_cast<int>(gen() % 6);
+    if (action < 4) {
+        world.playerMove(static_cast<Direction>(action));
+    } else {
+        world.playerFire();
+    }
+}
+
+MatchResult playMatch(const AIParams& params, const TunerOptions& options, int match) {
+    unsigned int seed = options.seed + static_cast<unsigned int>(match);
+    std::mt19937 botGen(seed ^ 0x9e3779b9u);
+
+    GameWorld world(40, 20);
+    world.setSeed(seed);
+    world.setAIParams(params);
+    world.loadLevel(1 + match % 6);
+
+    MatchResult result = { false, false, 0, -1 };
+    int lives = world.getPlayer()->getLives();
+
+    while (result.ticks < options.maxTicks && world.getState() == GameState::PLAYING) {
+        if (options.bot == BotKind::HUNTER) {
+            hunterStep(world, botGen);
+        } else {
+            randomStep(world, botGen);
+        }
+        world.update();
+        result.ticks++;
+
+        if (result.firstKillTick < 0 && world.getPlayer()->getLives() < lives) {
+            result.firstKillTick = result.ticks;
+        }
+    }
+
+    result.playerWon = world.getState() == GameState::LEVEL_COMPLETE;
+    result.playerLost = world.getState() == GameState::GAME_OVER;
+    return result;
+}
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program
+              << " [--matches N] [--threads N] [--ticks N] [--seed N] [--bot hunter|random]"
+              << " [param=v1,v2,...]...\n\nParameters:\n";
+    for (const ParamField& field : PARAM_FIELDS) {
+        std::cout << "  " << field.name << " (default " << AIParams().*field.member << ")\n";
+    }
+}
+
+bool parseAxis(const char* arg, SweepAxis& axis) {
+    const char* eq = std::strchr(arg, '=');
+    if (!eq) return false;
+
+    std::string name(arg, eq);
+    axis.field = nullptr;
+    for (const ParamField& field : PARAM_FIELDS) {
+        if (name == field.name) axis.field = &field;
+    }
+    if (!axis.field) return false;
+
+    axis.values.clear();
+    const char* p = eq + 1;
+    while (*p) {
+        char* end = nullptr;
+        long value = std::strtol(p, &end, 10);
+        if (end == p) return false;
+        axis.values.push_back(static_cast<int>(value));
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return !axis.values.empty();
+}
+
+} // namespace
+
+/**
+ * @brief Runs every combination of swept AI parameters against a scripted bot.
+ * 
+ * Matches are independent worlds with their own seeds, so they are spread
+ * over worker threads without locking. The same seeds are reused for every
+ * configuration, which keeps comparisons between rows paired.
+ */
+int main(int argc, char* argv[]) {
+    TunerOptions options;
+    options.matches = 200;
+    options.threads = static_cast<int>(std::thread::hardware_concurrency());
+    options.maxTicks = 2000;
+    options.seed = 1;
+    options.bot = BotKind::HUNTER;
+    if (options.threads < 1) options.threads = 1;
+
+    std::vector<SweepAxis> axes;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--matches" && hasValue) {
+            options.matches = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--ticks" && hasValue) {
+            options.maxTicks = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--bot" && hasValue) {
+            std::string bot = argv[++i];
+            options.bot = (bot == "random") ? BotKind::RANDOM : BotKind::HUNTER;
+        } else {
+            SweepAxis axis;
+            if (!parseAxis(argv[i], axis)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            axes.push_back(axis);
+        }
+    }
+
+    // Без параметров подбираем меткость и дистанцию атаки
+    if (axes.empty()) {
+        SweepAxis shots = { &PARAM_FIELDS[4], { -20, 0, 20 } };
+        SweepAxis engage = { &PARAM_FIELDS[6], { 4, 6, 8 } };
+        axes.push_back(shots);
+        axes.push_back(engage);
+    }
+
+    // Декартово произведение значений всех осей
+    std::vector<AIParams> configs(1);
+    for (const SweepAxis& axis : axes) {
+        std::vector<AIParams> next;
+        for (const AIParams& base : configs) {
+            for (int value : axis.values) {
+                AIParams params = base;
+                params.*axis.field->member = value;
+                next.push_back(params);
+            }
+        }
+        configs.swap(next);
+    }
+
+    size_t jobCount = configs.size() * static_cast<size_t>(options.matches);
+    std::vector<MatchResult> results(jobCount);
+    std::atomic<size_t> nextJob(0);
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < options.threads; t++) {
+        workers.emplace_back([&]() {
+            for (size_t job = nextJob++; job < jobCount; job = nextJob++) {
+                size_t config = job / options.matches;
+                int match = static_cast<int>(job % options.matches);
+                results[job] = playMatch(configs[config], options, match);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%-40s %8s %8s %8s %10s %10s\n",
+                "config", "enemy%", "player%", "timeout", "ttk", "ticks");
+
+    long long totalTicks = 0;
+    for (size_t c = 0; c < configs.size(); c++) {
+        int enemyWins = 0, playerWins = 0, kills = 0;
+        long long ticks = 0, killTicks = 0;
+
+        for (int m = 0; m < options.matches; m++) {
+            const MatchResult& r = results[c * options.matches + m];
+            enemyWins += r.playerLost;
+            playerWins += r.playerWon;
+            ticks += r.ticks;
+            if (r.firstKillTick >= 0) {
+                kills++;
+                killTicks += r.firstKillTick;
+            }
+        }
+        totalTicks += ticks;
+
+        std::string label;
+        for (const SweepAxis& axis : axes) {
+            if (!label.empty()) label += ' ';
+            label += axis.field->name;
+            label += '=';
+            label += std::to_string(configs[c].*axis.field->member);
+        }
+
+        std::printf("%-40s %7.1f%% %7.1f%% %8d %10.1f %10.1f\n",
+                    label.c_str(),
+                    100.0 * enemyWins / options.matches,
+                    100.0 * playerWins / options.matches,
+                    options.matches - enemyWins - playerWins,
+                    kills ? static_cast<double>(killTicks) / kills : -1.0,
+                    static_cast<double>(ticks) / options.matches);
+    }
+
+    std::printf("\n%zu matches, %lld ticks in %.2f s on %d threads (%.0f ticks/s)\n",
+                jobCount, totalTicks, seconds, options.threads,
+                seconds > 0 ? totalTicks / seconds : 0.0);
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file render_bench.cpp
+ * @author Vld251
+ * @brief Measures game frame rendering cost without a terminal.
+ * @version 0.1
+ * @date 2025-12-07
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#include "model/GameWorld.h"
+#include "view/ConsoleRenderer.h"
+#include "view/RenderSink.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace {
+
+const int SCREEN_WIDTH = 120;   ///< Simulated terminal width
+const int SCREEN_HEIGHT = 50;   ///< Simulated terminal height
+
+/**
+ * @brief Settings of a benchmark run.
+ */
+struct BenchOptions {
+    int frames;                 ///< Frames to render
+    unsigned int seed;          ///< World and player seed
+    std::string sink;           ///< null, memory or path of an asciicast file
+    std::string theme;          ///< Glyph theme name
+    bool dump;                  ///< Print last frame from memory sink
+};
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program
+              << " [--frames N] [--seed N] [--sink null|memory|FILE.cast] [--theme NAME] [--dump]\n";
+}
+
+} // namespace
+
+/**
+ * @brief Plays random moves and renders every tick into the chosen sink.
+ * 
+ * Only ConsoleRenderer::render is timed; simulation and snapshot building
+ * are excluded, so the numbers show pure encoding and output cost.
+ */
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    options.frames = 20000;
+    options.seed = 1;
+    options.sink = "null";
+    options.theme = "advanced";
+    options.dump = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--frames" && hasValue) {
+            options.frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--sink" && hasValue) {
+            options.sink = argv[++i];
+        } else if (arg == "--theme" && hasValue) {
+            options.theme = argv[++i];
+        } else if (arg == "--dump") {
+            options.dump = true;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::unique_ptr<RenderSink> sink;
+    NullSink* nullSink = nullptr;
+    MemorySink* memorySink = nullptr;
+    if (options.sink == "null") {
+        nullSink = new NullSink(SCREEN_WIDTH, SCREEN_HEIGHT);
+        sink.reset(nullSink);
+    } else if (options.sink == "memory") {
+        memorySink = new MemorySink(SCREEN_WIDTH, SCREEN_HEIGHT);
+        sink.reset(memorySink);
+    } else {
+        AsciicastSink* recorder = new AsciicastSink(options.sink, SCREEN_WIDTH, SCREEN_HEIGHT);
+        sink.reset(recorder);
+        if (!recorder->isOpen()) {
+            std::cerr << "Cannot open " << options.sink << "\n";
+            return 1;
+        }
+    }
+
+    ConsoleRenderer renderer;
+    renderer.setSink(sink.get());
+    if (!renderer.setTheme(options.theme)) {
+        std::cerr << "Unknown theme " << options.theme << "\n";
+        return 1;
+    }
+
+    GameWorld world(40, 20);
+    world.setSeed(options.seed);
+    world.loadLevel(1);
+    std::mt19937 rng(options.seed);
+    RenderSnapshot snapshot;
+
+    std::chrono::steady_clock::duration renderTime(0);
+    int level = 1;
+    for (int frame = 0; frame < options.frames; frame++) {
+        if (world.getState() != GameState::PLAYING) {
+            level = level % 6 + 1;
+            world.loadLevel(level);
+        }
+
+        int action = std::uniform_int_distribution<>(0, 5)(rng);
+        if (action < 4) {
+            world.playerMove(static_cast<Direction>(action));
+        } else {
+            world.playerFire();
+        }
+        world.update();
+        world.buildSnapshot(snapshot);
+
+        auto start = std::chrono::steady_clock::now();
+        renderer.render(snapshot);
+        renderTime += std::chrono::steady_clock::now() - start;
+    }
+
+    double seconds = std::chrono::duration<double>(renderTime).count();
+    size_t bytes = nullSink ? nullSink->getBytesWritten()
+                 : memorySink ? memorySink->getBytesWritten() : 0;
+
+    std::printf("frames %d | render %.2f us/frame | %.0f frames/s",
+                options.frames, seconds * 1e6 / options.frames, options.frames / seconds);
+    if (bytes > 0) {
+        std::printf(" | %.0f bytes/frame", static_cast<double>(bytes) / options.frames);
+    }
+    std::printf("\n");
+
+    if (memorySink && options.dump) {
+        for (int y = 0; y < SCREEN_HEIGHT; y++) {
+            std::cout << memorySink->getLine(y) << "\n";
+        }
+    }
+    return 0;
+}